@@ -0,0 +1,113 @@
+#~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~#
+#          Compile Time Benchmark
+#~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~#
+# Times One Translation Unit Per Include Set - Run From The Build Folder:
+#	cmake  -DCXX=g++  [-DRUNS=5]  [-DCXX_FLAGS="-O2"]  -P ../CompileBenchmark.cmake
+#	cmake  -DCXX=cl   [-DRUNS=5]  [-DCXX_FLAGS="/O2"]  -P ../CompileBenchmark.cmake
+# **Note: Generated Sources Use .cxx So The Root CMakeLists.txt Never Globs Them
+cmake_minimum_required( VERSION 3.23 ) # string( TIMESTAMP ) Microseconds
+
+
+# Set Benchmark Controls
+if ( NOT CXX )
+	message( FATAL_ERROR "Pass The Compiler To Benchmark, e.g. -DCXX=g++" )
+endif()
+if ( NOT RUNS )
+	set( RUNS  5 )
+endif()
+if ( NOT SCHEDULER_DIR )
+	set( SCHEDULER_DIR  "${CMAKE_CURRENT_LIST_DIR}/ThreadScheduler" )
+endif()
+separate_arguments( CXX_FLAGS )
+
+set( WORK_DIR  "${CMAKE_CURRENT_BINARY_DIR}/CompileBenchmark" )
+file( MAKE_DIRECTORY  "${WORK_DIR}" )
+
+
+# Compiler Specific Flags - MSVC Or GCC/Clang Style
+get_filename_component( CXX_NAME  "${CXX}"  NAME_WE )
+if ( CXX_NAME STREQUAL "cl" OR CXX_NAME STREQUAL "clang-cl" )
+	set( BASE_FLAGS  /nologo  /std:c++20  /EHsc  /c  "/I${SCHEDULER_DIR}"  "/Fo${WORK_DIR}/" )
+	set( DEFINE_FLAG  "/D" )
+else()
+	set( BASE_FLAGS  -std=c++20  -c  "-I${SCHEDULER_DIR}"  -o  "${WORK_DIR}/Benchmark.o" )
+	set( DEFINE_FLAG  "-D" )
+endif()
+
+
+# Same Pool Usage In Every Translation Unit - Only The Includes Differ
+set( Benchmark_Body
+"int UsePool(jpd::ThreadPool& Pool)
+{
+    auto Single = Pool.QueueFunction([]{ return 1; });
+    auto Loop   = Pool.QueueAndPartitionLoop(0, 1000, 8, 0, [](size_t a, size_t b){ return int(b - a); });
+
+    int Sum = Single.get();
+    for (int Value : Loop.GetResults())
+    {
+        Sum += Value;
+    }
+    return Sum;
+}
+" )
+
+#	<Name>                 <Defines>                          <Includes>
+set( Variant_Names
+	"Monolithic"         # Everything Behind The Old pch.h Include Path, Without A Precompiled Header
+	"Core"               # includes/thread_pool_includes.h Only
+	"Core_Extern"        # Core + GroupTasks<T> Instantiated In jpd::threadscheduler_instantiations
+	"Core_Profiler_IO"   # Core + Both Opt-In Headers
+)
+set( Monolithic_Includes        "pch/pch.h;includes/thread_pool_includes.h;includes/task_profiler_includes.h;includes/io_reactor_includes.h" )
+set( Core_Includes              "includes/thread_pool_includes.h" )
+set( Core_Extern_Includes       "includes/thread_pool_includes.h" )
+set( Core_Extern_Defines        "JPD_SCHEDULER_EXTERN_TEMPLATES" )
+set( Core_Profiler_IO_Includes  "includes/task_profiler_includes.h;includes/io_reactor_includes.h" )
+
+
+# Write Each Variant's Translation Unit
+foreach( Variant  IN LISTS  Variant_Names )
+	set( Source_Text  "" )
+	foreach( Include  IN LISTS  ${Variant}_Includes )
+		string( APPEND  Source_Text  "#include \"${Include}\"\n" )
+	endforeach()
+	file( WRITE  "${WORK_DIR}/${Variant}.cxx"  "${Source_Text}\n${Benchmark_Body}" )
+
+	set( ${Variant}_Flags  "" )
+	foreach( Define  IN LISTS  ${Variant}_Defines )
+		list( APPEND  ${Variant}_Flags  "${DEFINE_FLAG}${Define}" )
+	endforeach()
+
+	set( ${Variant}_Times  "" )
+endforeach()
+
+
+# Compile The Variants Round-Robin RUNS Times - Cache Warm-Up & Machine Load Drift Hit Every Variant Alike
+message( "Compiler: ${CXX} ${CXX_FLAGS} | Runs: ${RUNS}" )
+foreach( Run  RANGE  1  ${RUNS} )
+	foreach( Variant  IN LISTS  Variant_Names )
+		string( TIMESTAMP  Start_Us  "%s%f" )
+		execute_process( COMMAND  ${CXX}  ${BASE_FLAGS}  ${CXX_FLAGS}  ${${Variant}_Flags}  "${WORK_DIR}/${Variant}.cxx"
+						 RESULT_VARIABLE  Result
+						 OUTPUT_VARIABLE  Output
+						 ERROR_VARIABLE   Output )
+		string( TIMESTAMP  End_Us  "%s%f" )
+
+		if ( NOT Result EQUAL 0 )
+			message( FATAL_ERROR "${Variant} Failed To Compile:\n${Output}" )
+		endif()
+
+		math( EXPR  Elapsed_Ms  "(${End_Us} - ${Start_Us}) / 1000" )
+		list( APPEND  ${Variant}_Times  ${Elapsed_Ms} )
+	endforeach()
+endforeach()
+
+
+# Report The Median & Minimum Wall Time Per Variant
+foreach( Variant  IN LISTS  Variant_Names )
+	list( SORT  ${Variant}_Times  COMPARE NATURAL )
+	math( EXPR  Median_Index  "${RUNS} / 2" )
+	list( GET  ${Variant}_Times  ${Median_Index}  Median_Ms )
+	list( GET  ${Variant}_Times  0  Min_Ms )
+	message( "\t${Variant}: Median ${Median_Ms} ms | Min ${Min_Ms} ms" )
+endforeach()
\ No newline at end of file
@@ -1,4 +1,10 @@
 #include "includes/thread_pool_includes.h"
+#include "includes/task_profiler_includes.h"
+#include "includes/io_reactor_includes.h"
+
+#if defined(__linux__)
+    #include <sys/socket.h>
+#endif
 
 // normal fn
 // normal fn with args
@@ -62,6 +68,35 @@ struct AdditionClass
 };
 
 
+// Runs Both Benchmarks Runs Times, Alternating Which Goes First So Warm-Up & Clock Drift Hit Both Alike
+template <typename Bench_A, typename Bench_B>
+std::array<std::vector<double>, 2> TimeAlternating(const size_t Runs, Bench_A&& A, Bench_B&& B)
+{
+    std::array<std::vector<double>, 2> Timings;
+    for (size_t Run = 0; Run < Runs; ++Run)
+    {
+        if (Run % 2)
+        {
+            Timings[1].push_back(B());
+            Timings[0].push_back(A());
+        }
+        else
+        {
+            Timings[0].push_back(A());
+            Timings[1].push_back(B());
+        }
+    }
+    return Timings;
+}
+
+// "Min Xms / Median Yms" - A Single Run Is Too Noisy To Compare
+std::string FormatTimings(std::vector<double> Timings)
+{
+    std::sort(Timings.begin(), Timings.end());
+    return "Min " + std::to_string(Timings.front()) + "ms / Median " + std::to_string(Timings[Timings.size() / 2]) + "ms";
+}
+
+
 int main()
 {
     // Construct Thread Pool w/ Max Available Threads
@@ -170,6 +205,307 @@ int main()
     }
 
 
+    // Case 4: Tiled Loop
+    std::cout << "Case 4: Tiled Loop" << std::endl;
+    {
+        // 2D Range - Col Boundaries Aligned To Cache Lines Of floats
+        constexpr size_t Rows = 48, Cols = 100;
+        std::vector<float> Image(Rows * Cols, 1.0f);
+        auto LAMBDA_Tiles = Pool.QueueAndPartitionLoop( jpd::BlockedRange2D{ .m_Rows = { 0, Rows }, .m_Cols = { 0, Cols } }
+                                                      , 16
+                                                      , jpd::AlignTo<float>()
+                                                      , [](jpd::BlockedRange2D Tile, std::vector<float>& Pixels, size_t Stride)
+                                                        {
+                                                            float Sum = 0.0f;
+                                                            for (size_t r = Tile.m_Rows.m_Begin; r < Tile.m_Rows.m_End; ++r)
+                                                            {
+                                                                for (size_t c = Tile.m_Cols.m_Begin; c < Tile.m_Cols.m_End; ++c)
+                                                                {
+                                                                    Sum += Pixels[r * Stride + c];
+                                                                }
+                                                            }
+                                                            return Sum;
+                                                        }, REF(Image), Cols );
+        std::cout << "\tTile Sums: ";
+        for (auto v : LAMBDA_Tiles.GetResults())
+        {
+            std::cout << v << " ";
+        }
+        std::cout << "\n";
+    }
+
+
+    // Case 5: False Sharing Benchmark
+    std::cout << "Case 5: False Sharing Benchmark" << std::endl;
+    {
+        // Each Worker Hammers Its Own Chunk - Unaligned Chunks Share Cache Lines With Their Neighbours
+        const size_t Partitions = std::thread::hardware_concurrency();
+        const size_t Start      = 3;
+        const size_t End        = Start + Partitions * (jpd::CacheLineSize / sizeof(int64_t));
+
+        // Cache Line Aligned Storage - Index 0 Starts A Line, So Start = 3 Straddles Lines Unless Aligned
+        int64_t* Counters = static_cast<int64_t*>(::operator new[](End * sizeof(int64_t), std::align_val_t{ jpd::CacheLineSize }));
+        std::fill(Counters, Counters + End, 0);
+
+        auto Increment = [](size_t a, size_t b, int64_t* value)
+                         {
+                             volatile int64_t* Data = value;
+                             for (size_t Repeat = 0; Repeat < 2'000'000; ++Repeat)
+                             {
+                                 for (size_t i = a; i < b; ++i)
+                                 {
+                                     Data[i] = Data[i] + 1;
+                                 }
+                             }
+                         };
+
+        auto Time = [&](auto&& Queue)
+                    {
+                        const auto Begin = std::chrono::steady_clock::now();
+                        Queue().WaitForAll();
+                        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - Begin).count();
+                    };
+
+        const auto Timings = TimeAlternating( 5
+                                            , [&]{ return Time([&]{ return Pool.QueueAndPartitionLoop( Start, End, Partitions, 0, Increment, Counters ); }); }
+                                            , [&]{ return Time([&]{ return Pool.QueueAndPartitionAlignedLoop( Start, End, Partitions, 0, jpd::AlignTo(Counters), Increment, Counters ); }); } );
+
+        std::cout << "\tUnaligned: " << FormatTimings(Timings[0]) << " | Cache Line Aligned: " << FormatTimings(Timings[1]) << std::endl;
+        ::operator delete[](Counters, std::align_val_t{ jpd::CacheLineSize });
+    }
+
+
+    // Case 6: Affinity Benchmark
+    std::cout << "Case 6: Affinity Benchmark" << std::endl;
+    {
+        // Iterative Solver Style - Many Passes Over An Array That Fits In The Combined Caches
+        std::vector<double> Values(1 << 16, 1.0);
+        jpd::AffinityPartitioner Partitioner;
+
+        auto Relax = [](size_t a, size_t b, std::vector<double>& value)
+                     {
+                         for (size_t i = a; i < b; ++i)
+                         {
+                             value[i] = value[i] * 0.5 + 0.5;
+                         }
+                     };
+
+        auto Time = [&](auto&& Queue)
+                    {
+                        const auto Begin = std::chrono::steady_clock::now();
+                        for (size_t Pass = 0; Pass < 200; ++Pass)
+                        {
+                            Queue().WaitForAll();
+                        }
+                        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - Begin).count();
+                    };
+
+        const auto Timings = TimeAlternating( 5
+                                            , [&]{ return Time([&]{ return Pool.QueueAndPartitionLoop( 0, Values.size(), std::thread::hardware_concurrency(), 0, Relax, REF(Values) ); }); }
+                                            , [&]{ return Time([&]{ return Pool.QueueAndPartitionLoop( 0, Values.size(), std::thread::hardware_concurrency(), 0, Partitioner, Relax, REF(Values) ); }); } );
+
+        std::cout << "\tShared Queue: " << FormatTimings(Timings[0]) << " | Affinity Partitioner: " << FormatTimings(Timings[1]) << std::endl;
+    }
+
+
+#if defined(__linux__)
+    // Case 7: Asynchronous I/O
+    std::cout << "Case 7: Asynchronous I/O" << std::endl;
+    {
+        int Pipe[2];
+        if (pipe(Pipe) == 0)
+        {
+            // Read Is Pending Until The Write Lands - No Worker Blocks In read()
+            std::array<std::byte, 16> Buffer{};
+            auto IO_Read = Pool.GetIOReactor().AsyncRead( Pipe[0], Buffer );
+
+            const std::string_view Message = "Hello Pipe";
+            auto IO_Write = Pool.GetIOReactor().AsyncWrite( Pipe[1], std::as_bytes(std::span(Message)) );
+
+            // Completion Queued As A Pool Task
+            std::promise<uint32_t> Polled;
+            Pool.GetIOReactor().AsyncPoll( Pipe[1], EPOLLOUT, [&Polled](jpd::IOResult Result){ Polled.set_value(Result.m_Events); } );
+
+            std::cout << "\tWrote: " << IO_Write.get().m_Bytes
+                      << " | Read: " << std::string_view(reinterpret_cast<const char*>(Buffer.data()), IO_Read.get().m_Bytes)
+                      << " | Polled Events: " << Polled.get_future().get() << std::endl;
+
+            close(Pipe[0]);
+            close(Pipe[1]);
+        }
+
+        // Regular File At An Offset - Never Ready To epoll, So It Goes Through io_uring (Or A Pool Task)
+        char Path[] = "/tmp/jpd_io_XXXXXX";
+        const int File = mkstemp(Path);
+        if (File >= 0)
+        {
+            unlink(Path);
+
+            const std::string_view Message = "Hello File";
+            const auto FILE_Write = Pool.GetIOReactor().AsyncWrite( File, std::as_bytes(std::span(Message)), 4096 ).get();
+
+            std::array<std::byte, 16> Buffer{};
+            const auto FILE_Read = Pool.GetIOReactor().AsyncRead( File, Buffer, 4096 ).get();
+
+            std::cout << "\tFile Wrote: " << FILE_Write.m_Bytes << " @ 4096"
+                      << " | Read: " << std::string_view(reinterpret_cast<const char*>(Buffer.data()), FILE_Read.m_Bytes) << std::endl;
+            close(File);
+        }
+
+        // Socket Pair - The Callback Closes Its Descriptor, Which The Next Socket Pair Then Reuses
+        int Sockets[2];
+        if (socketpair(AF_UNIX, SOCK_STREAM, 0, Sockets) == 0)
+        {
+            std::array<std::byte, 16> Buffer{};
+            std::promise<int64_t> Received;
+            Pool.GetIOReactor().AsyncRead( Sockets[0], Buffer, -1, [&Received, Socket = Sockets[0]](jpd::IOResult Result)
+                                                                   {
+                                                                       close(Socket);
+                                                                       Received.set_value(Result.m_Bytes);
+                                                                   } );
+
+            const std::string_view Message = "Hello Socket";
+            const auto SOCKET_Write = Pool.GetIOReactor().AsyncWrite( Sockets[1], std::as_bytes(std::span(Message)) ).get();
+            const auto SOCKET_Read  = Received.get_future().get();
+
+            // Same Descriptor Number, New Socket - Only Works Because It Was Deregistered Before The Callback Ran
+            int Reused[2];
+            if (socketpair(AF_UNIX, SOCK_STREAM, 0, Reused) == 0)
+            {
+                std::array<std::byte, 16> ReusedBuffer{};
+                auto REUSED_Read = Pool.GetIOReactor().AsyncRead( Reused[0], ReusedBuffer );
+                [[maybe_unused]] auto Written = write(Reused[1], Message.data(), Message.size());
+
+                std::cout << "\tSocket Wrote: " << SOCKET_Write.m_Bytes << " | Read: " << SOCKET_Read
+                          << " | Descriptor " << Sockets[0] << (Reused[0] == Sockets[0] ? " Reused" : " Not Reused")
+                          << " | Read: " << REUSED_Read.get().m_Bytes << std::endl;
+
+                close(Reused[0]);
+                close(Reused[1]);
+            }
+            close(Sockets[1]);
+        }
+
+        // Closed Peers - Both Writes Report EPIPE Instead Of Killing The Process With SIGPIPE
+        int Broken_Pipe[2], Broken_Sockets[2];
+        if (pipe(Broken_Pipe) == 0 && socketpair(AF_UNIX, SOCK_STREAM, 0, Broken_Sockets) == 0)
+        {
+            close(Broken_Pipe[0]);
+            close(Broken_Sockets[0]);
+
+            const std::string_view Message = "Hello Nobody";
+            const auto PIPE_Broken   = Pool.GetIOReactor().AsyncWrite( Broken_Pipe[1], std::as_bytes(std::span(Message)) ).get();
+            const auto SOCKET_Broken = Pool.GetIOReactor().AsyncWrite( Broken_Sockets[1], std::as_bytes(std::span(Message)) ).get();
+
+            std::cout << "	Closed Pipe Write: " << (PIPE_Broken.m_Error == EPIPE ? "EPIPE" : "Unexpected")
+                      << " | Closed Socket Write: " << (SOCKET_Broken.m_Error == EPIPE ? "EPIPE" : "Unexpected") << std::endl;
+
+            close(Broken_Pipe[1]);
+            close(Broken_Sockets[1]);
+        }
+    }
+#endif
+
+
+    // Case 8: Task Arenas
+    std::cout << "Case 8: Task Arenas" << std::endl;
+    {
+        // Subsystems Share One Set Of Workers - Physics Gets 3x The Share Of Audio, Audio Never Exceeds 1 Thread
+        // But Keeps That Thread Reserved, So Its Tasks Start Even While Physics Occupies Every Other Worker
+        auto& Physics = jpd::ThreadPool::GetGlobal().CreateArena( "Physics", 0, 3 );
+        auto& Audio   = jpd::ThreadPool::GetGlobal().CreateArena( "Audio", 1, 1, 1 );
+
+        auto ARENA_Loop  = Physics.QueueAndPartitionLoop( 0, 1000, 16, 0, [](size_t a, size_t b){ return b - a; } );
+        auto ARENA_Mixer = Audio.QueueFunction( []{ return 44100; } );
+
+        size_t Iterations = 0;
+        for (auto v : ARENA_Loop.GetResults())
+        {
+            Iterations += v;
+        }
+        std::cout << "\t" << Physics.GetName() << " Iterations: " << Iterations
+                  << " | " << Audio.GetName() << " Sample Rate: " << ARENA_Mixer.get() << std::endl;
+    }
+
+
+#if defined(JPD_SCHEDULER_STRESS)
+    // Case 9: Scheduling Stress - Record A Seeded Run, Then Replay It In The Same Order
+    std::cout << "Case 9: Scheduling Stress" << std::endl;
+    {
+        Pool.SeedStress(0xC0FFEE);
+
+        auto& Stress_Narrow = Pool.CreateArena( "Stress_Narrow", 1 );
+        auto& Stress_Wide   = Pool.CreateArena( "Stress_Wide", 0, 2 );
+
+        // Shared, Pinned & Arena Queues - Replay Has To Order Starts Across All Of Them
+        auto RunTasks = [&]()
+                        {
+                            std::vector<std::future<void>> Futures;
+                            for (size_t i = 0; i < 64; ++i)
+                            {
+                                switch (i % 4)
+                                {
+                                case 0:  Futures.push_back(Pool.QueueFunction( []{ std::this_thread::yield(); } ));                   break;
+                                case 1:  Futures.push_back(Pool.QueueFunctionOnWorker( i / 4, []{ std::this_thread::yield(); } ));    break;
+                                case 2:  Futures.push_back(Stress_Narrow.QueueFunction( []{ std::this_thread::yield(); } ));          break;
+                                default: Futures.push_back(Stress_Wide.QueueFunction( []{ std::this_thread::yield(); } ));            break;
+                                }
+                            }
+                            for (auto& Future : Futures)
+                            {
+                                Future.wait();
+                            }
+                        };
+
+        Pool.WaitForAllTasks();
+        Pool.BeginRecording();
+        RunTasks();
+        const auto Recorded = Pool.EndRecording();
+
+        Pool.BeginReplay(Recorded);
+        RunTasks();
+        const auto Replayed = Pool.EndReplay();
+
+        Pool.SeedStress(0);
+        std::cout << "\tRecorded " << Recorded.size() << " Starts Across 4 Queues | Start Order "
+                  << (Recorded == Replayed ? "Reproduced" : "Diverged") << " On Replay" << std::endl;
+    }
+#endif
+
+
+    // Case 10: Task Profiling - Attribute Worker Time To Labelled Tasks
+    std::cout << "Case 10: Task Profiling" << std::endl;
+    {
+        Pool.GetProfiler().Reset();
+        Pool.GetProfiler().Enable();
+
+        auto PROFILE_Sum   = Pool.QueueAndPartitionLoop( "Sum Loop", 0, 4'000'000, 16, 0, [](size_t a, size_t b)
+                                                                                         {
+                                                                                             volatile size_t Sum = 0;
+                                                                                             for (size_t i = a; i < b; ++i)
+                                                                                             {
+                                                                                                 Sum = Sum + i;
+                                                                                             }
+                                                                                             return static_cast<size_t>(Sum);
+                                                                                         } );
+        auto PROFILE_Tiles  = Pool.QueueAndPartitionLoop( "Tile Loop", jpd::BlockedRange2D{ .m_Rows = { 0, 256 }, .m_Cols = { 0, 256 } }, 16, jpd::AlignTo<float>()
+                                                        , [](jpd::BlockedRange2D Tile){ return Tile.m_Rows.Size() * Tile.m_Cols.Size(); } );
+        auto PROFILE_Pinned = Pool.QueueFunctionOnWorker( "Pinned", 0, []{ std::this_thread::sleep_for(std::chrono::milliseconds(5)); } );
+        auto PROFILE_Sleep  = Pool.QueueFunction( "Sleep", []{ std::this_thread::sleep_for(std::chrono::milliseconds(20)); } );
+        auto PROFILE_Plain  = Pool.QueueFunction( []{ return 0; } );
+
+        PROFILE_Sum.WaitForAll();
+        PROFILE_Tiles.WaitForAll();
+        PROFILE_Pinned.wait();
+        PROFILE_Sleep.wait();
+        PROFILE_Plain.wait();
+        Pool.GetProfiler().Enable(false);
+
+        jpd::PrintTopN(Pool.GetProfiler(), std::cout, 5);
+        jpd::PrintFoldedStacks(Pool.GetProfiler(), std::cout);
+    }
+
+
 
 
 
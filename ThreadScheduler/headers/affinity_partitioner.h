@@ -0,0 +1,49 @@
+#pragma once
+
+#include <limits>
+#include <vector>
+#include <cstddef>
+
+namespace jpd
+{
+    constexpr size_t NoAffinity = std::numeric_limits<size_t>::max();                             // Task May Run On Any Worker Thread
+
+    /*
+        Remembers Which Worker Ran Each Chunk Of A Partitioned Loop So That
+        Repeated Passes Over The Same Data Land On The Same (Warm) Caches
+
+        **Note: Reuse The Same Partitioner Across Passes, And Wait For
+                Each Pass Before Queuing The Next
+    */
+    class AffinityPartitioner final
+    {
+    public:
+
+        AffinityPartitioner() noexcept = default;
+
+        inline
+        void Reset(void) noexcept;
+
+        [[nodiscard]] inline
+        size_t GetWorker(const size_t ChunkIndex) const noexcept;
+
+        inline
+        void RecordWorker( const size_t ChunkIndex
+                         , const size_t WorkerIndex ) noexcept;
+
+        [[nodiscard]] inline
+        size_t GetChunkCount(void) const noexcept;
+
+    private:
+
+        friend class ThreadPool;
+
+        // Keeps The Previous Mapping If The Loop Was Partitioned Identically, Otherwise Seeds A Round-Robin Mapping
+        inline
+        void Prepare( const std::vector<size_t>& Boundaries
+                    , const size_t               WorkerCount ) noexcept;
+
+        std::vector<size_t> m_Boundaries    = {};                                                   // Chunk Boundaries Of The Previous Pass
+        std::vector<size_t> m_ChunkWorkers  = {};                                                   // Worker Index That Last Executed Each Chunk
+    };
+}
\ No newline at end of file
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <future>
+#include <vector>
+#include <cstddef>
+
 /*
 Using Concepts On Non-Templated Member Functions Within Templated Class
 - https://stackoverflow.com/questions/63338629/requires-clause-for-a-non-template-member-function-in-a-template-class
@@ -16,16 +20,16 @@ namespace jpd
 
         inline void InsertFuture(std::future<ReturnType> Task) noexcept;
 
-        inline [[nodiscard]]
+        [[nodiscard]] inline
         std::future<ReturnType>& GetFuture(const size_t Index) noexcept;
 
-        inline [[nodiscard]]
+        [[nodiscard]] inline
         std::future<ReturnType>& operator[](const size_t Index) noexcept;
 
         //inline
         //void WaitForAll(void) noexcept requires( IsVoid_T<ReturnType> );
 
-        inline [[nodiscard]]
+        [[nodiscard]] inline
         std::vector<ReturnType> GetResults(void) noexcept requires( NotVoid_T<ReturnType> );
 
         inline void WaitForAll() noexcept;
@@ -34,4 +38,18 @@ namespace jpd
 
         std::vector<std::future<ReturnType>> m_Tasks;
     };
+
+
+    /*
+        Common Return Types - Instantiated Once In src/group_tasks_instantiations.cpp
+        (jpd::threadscheduler_instantiations) Instead Of In Every Translation Unit
+    */
+#if defined(JPD_SCHEDULER_EXTERN_TEMPLATES)
+    extern template class GroupTasks<void>;
+    extern template class GroupTasks<bool>;
+    extern template class GroupTasks<int>;
+    extern template class GroupTasks<size_t>;
+    extern template class GroupTasks<float>;
+    extern template class GroupTasks<double>;
+#endif
 }
\ No newline at end of file
@@ -0,0 +1,229 @@
+#pragma once
+
+#if defined(__linux__)
+
+#include <span>
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <future>
+#include <thread>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+
+#include <cerrno>
+#include <csignal>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/eventfd.h>
+
+// Regular File Reads/Writes Go Through io_uring When The Kernel Headers Have IORING_OP_READ/WRITE (Linux 5.6+)
+#if __has_include(<linux/io_uring.h>)
+    #include <sys/mman.h>
+    #include <sys/syscall.h>
+    #include <linux/io_uring.h>
+    #if defined(IORING_FEAT_RW_CUR_POS) && defined(__NR_io_uring_setup)
+        #define JPD_IO_URING
+    #endif
+#endif
+
+namespace jpd
+{
+    class ThreadPool;
+
+    enum class IOOperation : uint8_t
+    {
+        Read
+    ,   Write
+    ,   Poll
+    };
+
+    struct IOResult final
+    {
+        int64_t  m_Bytes  = 0;                                                                      // Bytes Transferred (Read/Write)
+        uint32_t m_Events = 0;                                                                      // Ready EPOLL* Events (Poll)
+        int      m_Error  = 0;                                                                      // errno Of The Failed Syscall - 0 On Success, ECANCELED On Shutdown
+    };
+
+#if defined(JPD_IO_URING)
+    // Mapped io_uring Queues - See IOReactor::SetupFileRing
+    struct IOFileRing final
+    {
+        int                 m_FD            = -1;                                                   // io_uring Instance - Readable Through m_EpollFD Once Completions Are Posted
+        uint32_t            m_Entries       = 0;                                                    // Submission Queue Size
+        void*               m_SQMap         = MAP_FAILED;
+        size_t              m_SQMapSize     = 0;
+        void*               m_CQMap         = MAP_FAILED;                                       // Same As m_SQMap Under IORING_FEAT_SINGLE_MMAP
+        size_t              m_CQMapSize     = 0;
+        io_uring_sqe*       m_SQEs          = nullptr;
+        uint32_t*           m_SQHead        = nullptr;
+        uint32_t*           m_SQTail        = nullptr;
+        uint32_t*           m_SQMask        = nullptr;
+        uint32_t*           m_SQArray       = nullptr;
+        uint32_t*           m_CQHead        = nullptr;
+        uint32_t*           m_CQTail        = nullptr;
+        uint32_t*           m_CQMask        = nullptr;
+        io_uring_cqe*       m_CQEs          = nullptr;
+    };
+#endif
+
+    /*
+        Completion Based I/O Owned By ThreadPool (See ThreadPool::GetIOReactor)
+
+        A Single Reactor Thread Waits On epoll And Issues The Syscalls Once A Descriptor
+        Is Ready, So Worker Threads Never Block On Pipes/Sockets. Completions Either
+        Fulfil The Returned std::future Or Are Queued As A Pool Task
+
+        **Note: Pollable Descriptors Are Switched To O_NONBLOCK On Submission
+        **Note: Regular Files Cannot Be Polled - Their Reads/Writes Are Submitted To An io_uring
+                Polled By The Same epoll Instance, Or Run As A Pool Task If io_uring Is Unavailable
+        **Note: Buffers Must Outlive The Operation
+        **Note: Writes To A Closed Peer Fail With EPIPE Instead Of Raising SIGPIPE
+        **Note: Task Completions Are Queued Under The "IOReactor" Profiler Label
+    */
+    class IOReactor final
+    {
+    public:
+
+        using CompletionFunc = std::function<void(IOResult)>;
+
+        explicit IOReactor(ThreadPool& Pool) noexcept;
+
+        ~IOReactor() noexcept;
+
+        IOReactor(const IOReactor&) = delete;
+        IOReactor& operator=(const IOReactor&) = delete;
+
+        // Offset < 0 Reads/Writes At The Current File Position
+        [[nodiscard]] inline
+        std::future<IOResult> AsyncRead( const int             FileDescriptor
+                                       , std::span<std::byte>  Buffer
+                                       , const int64_t         Offset = -1 ) noexcept;
+
+        [[nodiscard]] inline
+        std::future<IOResult> AsyncWrite( const int                  FileDescriptor
+                                        , std::span<const std::byte> Buffer
+                                        , const int64_t              Offset = -1 ) noexcept;
+
+        [[nodiscard]] inline
+        std::future<IOResult> AsyncPoll( const int      FileDescriptor
+                                       , const uint32_t Events ) noexcept;
+
+        // OnComplete( IOResult ) Is Queued As A Pool Task Once The Operation Completes
+        template <typename Func>
+        inline
+        void AsyncRead( const int            FileDescriptor
+                      , std::span<std::byte> Buffer
+                      , const int64_t        Offset
+                      , Func&&               OnComplete ) noexcept;
+
+        template <typename Func>
+        inline
+        void AsyncWrite( const int                  FileDescriptor
+                       , std::span<const std::byte> Buffer
+                       , const int64_t              Offset
+                       , Func&&                     OnComplete ) noexcept;
+
+        template <typename Func>
+        inline
+        void AsyncPoll( const int      FileDescriptor
+                      , const uint32_t Events
+                      , Func&&         OnComplete ) noexcept;
+
+    private:
+
+        struct Operation final
+        {
+            IOOperation     m_Type            = IOOperation::Poll;
+            int             m_FileDescriptor  = -1;
+            std::byte*      m_Buffer          = nullptr;
+            size_t          m_Size            = 0;
+            int64_t         m_Offset          = -1;
+            uint32_t        m_Events          = 0;                                                  // Events Required Before The Syscall Can Be Issued
+            bool            m_IsSocket        = false;                                              // Writes Use send(MSG_NOSIGNAL) - Set By Register
+            CompletionFunc  m_OnComplete      = {};
+        };
+
+        inline
+        void Submit(Operation Op) noexcept;
+
+        [[nodiscard]] inline
+        std::future<IOResult> SubmitForFuture(Operation Op) noexcept;
+
+        template <typename Func>
+        inline
+        void SubmitForTask( Operation Op
+                          , Func&&    OnComplete ) noexcept;
+
+        inline
+        void ReactorThread(void) noexcept;
+
+        inline
+        void Register(Operation Op) noexcept;
+
+        inline
+        void Dispatch( const int      FileDescriptor
+                     , const uint32_t ReadyEvents ) noexcept;
+
+        inline
+        void UpdateInterest(const int FileDescriptor) noexcept;
+
+        // Issues The Syscall - Returns False If The Descriptor Would Block
+        [[nodiscard]] static inline
+        bool TryComplete( Operation&     Op
+                        , const uint32_t ReadyEvents
+                        , IOResult&      Result ) noexcept;
+
+        inline
+        void Wake(void) noexcept;
+
+        /*
+            Regular File I/O - Reactor Thread Only
+        */
+        inline
+        void SubmitFile(Operation Op) noexcept;
+
+#if defined(JPD_IO_URING)
+        static constexpr uint32_t File_Ring_Entries = 64;                                           // Maximum File Operations In Flight - The Rest Wait In m_FileBacklog
+
+        // Leaves m_Ring.m_FD At -1 (Pool Task Fallback) If The Kernel Refuses The Ring (e.g. Pre-5.6, Seccomp, io_uring_disabled)
+        inline
+        void SetupFileRing(void) noexcept;
+
+        inline
+        void TeardownFileRing(void) noexcept;
+
+        // Moves Backlogged Operations Into Free Submission Slots & Hands Them To The Kernel
+        inline
+        void FlushFileBacklog(void) noexcept;
+
+        inline
+        void ReapFileCompletions(void) noexcept;
+#endif
+
+
+        ThreadPool&                                       m_Pool;
+        int                                               m_EpollFD         = -1;                  // epoll Instance Watching All Pending Descriptors
+        int                                               m_WakeFD          = -1;                  // eventfd Used To Wake The Reactor For New Submissions/Shutdown
+        std::atomic_bool                                  m_Running         = false;                // Controls Reactor Thread
+        std::mutex                                        m_MutexLock       = {};                   // Guards m_Submissions
+        std::vector<Operation>                            m_Submissions     = {};                   // Operations Waiting To Be Picked Up By The Reactor Thread
+        std::unordered_map<int, std::deque<Operation>>    m_Pending         = {};                   // Reactor Thread Only - Operations Waiting On Each Descriptor
+#if defined(JPD_IO_URING)
+        IOFileRing                                        m_Ring            = {};                   // Regular File I/O Ring - m_FD < 0 If Unavailable
+        std::deque<Operation>                             m_FileBacklog     = {};                   // Reactor Thread Only - File Operations Waiting For A Ring Slot
+        std::unordered_map<uint64_t, Operation>           m_FileInFlight    = {};                   // Reactor Thread Only - File Operations Owned By The Kernel, By user_data
+        uint64_t                                          m_NextFileToken   = 0;                    // user_data Of The Next File Operation
+#endif
+        std::thread                                       m_Thread          = {};                   // Reactor Thread
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <array>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace jpd
+{
+    /*
+        Partition Alignment
+    */
+    constexpr size_t CacheLineSize  = 64;                                                           // Bytes Per Cache Line - Chunk Boundaries Aligned To This Avoid False Sharing
+    constexpr size_t PageSize       = 4096;                                                         // Bytes Per Memory Page - Chunk Boundaries Aligned To This Avoid Sharing Pages/TLB Entries
+
+    struct PartitionAlignment final
+    {
+        size_t m_ElementSize  = 1;                                                                  // Size (In Bytes) Of Each Element Indexed By The Loop
+        size_t m_Alignment    = CacheLineSize;                                                      // Byte Boundary Each Chunk Should Begin On - Power Of 2
+        size_t m_AlignedIndex = 0;                                                                  // Any Index Whose Element Begins On m_Alignment - 0 If The Data Itself Is Aligned
+
+        // Number Of Elements Between Two Aligned Chunk Boundaries
+        [[nodiscard]] constexpr inline
+        size_t GetGranularity(void) const noexcept;
+    };
+
+    // Assumes Element 0 Begins On Alignment - e.g. Storage From operator new[] With std::align_val_t
+    template <typename T>
+    [[nodiscard]] constexpr inline
+    PartitionAlignment AlignTo(const size_t Alignment = CacheLineSize) noexcept;
+
+    // Boundaries Follow The Actual Addresses Of The Elements, So Unaligned Storage (e.g. std::vector) Still Gets Aligned Chunks
+    template <typename T>
+    [[nodiscard]] inline
+    PartitionAlignment AlignTo( const T*     Base
+                              , const size_t Alignment = CacheLineSize ) noexcept;
+
+
+    /*
+        Blocked Ranges - [Begin, End) Per Dimension
+    */
+    struct BlockedRange final
+    {
+        size_t m_Begin     = 0;                                                                     // First Index Of The Range
+        size_t m_End       = 0;                                                                     // One Past The Last Index Of The Range
+        size_t m_GrainSize = 1;                                                                     // Minimum Number Of Indexes Per Tile Along This Dimension
+
+        [[nodiscard]] constexpr inline
+        size_t Size(void) const noexcept;
+
+        [[nodiscard]] constexpr inline
+        bool Empty(void) const noexcept;
+    };
+
+    // Tiled Image/Matrix Loops - Cols Are The Contiguous (Innermost) Dimension
+    struct BlockedRange2D final
+    {
+        BlockedRange m_Rows = {};
+        BlockedRange m_Cols = {};
+    };
+
+    // Tiled Volume Loops - Cols Are The Contiguous (Innermost) Dimension
+    struct BlockedRange3D final
+    {
+        BlockedRange m_Pages = {};
+        BlockedRange m_Rows  = {};
+        BlockedRange m_Cols  = {};
+    };
+
+
+    /*
+        Partition Helper Functions
+    */
+    [[nodiscard]] constexpr inline
+    size_t DivideRoundUp( const size_t Numerator
+                        , const size_t Denominator ) noexcept;
+
+    [[nodiscard]] constexpr inline
+    size_t RoundUpToMultiple( const size_t Value
+                            , const size_t Multiple ) noexcept;
+
+    // Splits [Begin, End) Into At Most PartitionCount Chunks Whose Inner Boundaries Are Congruent To AlignedIndex (Mod Granularity)
+    [[nodiscard]] inline
+    std::vector<size_t> PartitionRange( const size_t Begin
+                                      , const size_t End
+                                      , const size_t PartitionCount
+                                      , const size_t MinimumPartitionSize = 0
+                                      , const size_t Granularity = 1
+                                      , const size_t AlignedIndex = 0 ) noexcept;
+
+    // Picks The Number Of Tiles Along Each Dimension So That Their Product Approaches, But Never Exceeds, PartitionCount
+    template <size_t N>
+    [[nodiscard]] inline
+    std::array<size_t, N> ComputeTileCounts( const std::array<size_t, N>& Extents
+                                           , const std::array<size_t, N>& GrainSizes
+                                           , const size_t                 PartitionCount ) noexcept;
+}
\ No newline at end of file
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+/*
+    Scheduling Stress Mode - Build With JPD_SCHEDULER_STRESS Defined
+
+    Injects Seeded Yields/Sleeps At Queue Push/Pop And Wait Points To Shake Out Races,
+    And Records The Order Tasks Are Popped So A Failing Run Can Be Replayed In The Same Order
+
+    **Note: Yield Decisions Are A Pure Function Of (Seed, Worker Index, Point, Call Count)
+            So The Same Seed Injects The Same Delays On Each Worker Thread. Call Counts Restart
+            On Seed, BeginRecording & BeginReplay, So A Replay Sees The Recorded Run's Delays
+    **Note: Replay Enforces The Recorded Start Order Of Tasks - Submissions Must Be
+            Issued In The Same Order As The Recorded Run (e.g. From A Single Thread)
+*/
+#if defined(JPD_SCHEDULER_STRESS)
+    #define JPD_STRESS_POINT(Stress, Point, WorkerIndex)  \
+        (Stress).Inject(Point, WorkerIndex)
+#else
+    #define JPD_STRESS_POINT(Stress, Point, WorkerIndex)
+#endif
+
+namespace jpd
+{
+    enum class StressPoint : uint8_t
+    {
+        QueuePush
+    ,   QueuePop
+    ,   Wait
+    ,   Count
+    };
+
+    // Per Thread Stress Point Call Counts - See ScheduleStress::t_Counts
+    struct StressCallCounts final
+    {
+        uint64_t                                                        m_Epoch     = 0;            // ScheduleStress::m_Epoch These Counts Belong To
+        std::array<uint64_t, static_cast<size_t>(StressPoint::Count)>  m_PerPoint  = {};           // Stress Points Hit By The Calling Thread, Per Point
+    };
+
+    class ScheduleStress final
+    {
+    public:
+
+        /*
+            Yield Injection
+        */
+        inline
+        void Seed(const uint64_t Seed) noexcept;
+
+        inline
+        void Inject( const StressPoint Point
+                   , const size_t      WorkerIndex ) noexcept;
+
+        /*
+            Record & Replay - Called With ThreadPool::m_MutexLock Held
+        */
+        inline
+        void BeginRecording(void) noexcept;
+
+        [[nodiscard]] inline
+        std::vector<uint64_t> EndRecording(void) noexcept;
+
+        inline
+        void BeginReplay(std::vector<uint64_t> TaskOrder) noexcept;
+
+        // Task IDs In The Order They Actually Started - Equals The Replayed Order If Replay Held
+        [[nodiscard]] inline
+        std::vector<uint64_t> EndReplay(void) noexcept;
+
+        [[nodiscard]] inline
+        bool IsReplaying(void) const noexcept;
+
+        // False If Replaying And TaskID Is Not The Next Task In The Recorded Order
+        [[nodiscard]] inline
+        bool CanStart(const uint64_t TaskID) const noexcept;
+
+        inline
+        void OnTaskStarted(const uint64_t TaskID) noexcept;
+
+    private:
+
+        [[nodiscard]] static constexpr inline
+        uint64_t Mix(uint64_t Value) noexcept;
+
+        // Restarts Every Thread's Call Counts The Next Time It Reaches A Stress Point
+        inline
+        void NewEpoch(void) noexcept;
+
+        [[nodiscard]] static inline
+        uint64_t NextEpoch(void) noexcept;
+
+
+        std::atomic_uint64_t    m_Seed          = 0;                                                // 0 Disables Yield Injection
+        std::atomic_uint64_t    m_Epoch         = NextEpoch();                                      // Unique Per Process - Changes On Seed/BeginRecording/BeginReplay
+        bool                    m_Recording     = false;
+        bool                    m_Replaying     = false;
+        size_t                  m_ReplayCursor  = 0;                                                // Index Of The Next Task To Start In m_TaskOrder
+        std::vector<uint64_t>   m_TaskOrder     = {};                                               // Recorded/Replayed Task IDs In Start Order
+        std::vector<uint64_t>   m_StartedOrder  = {};                                               // Task IDs Started While Replaying
+
+        static inline thread_local StressCallCounts t_Counts = {};                                   // Calling Thread's Call Counts For The Most Recent Epoch It Saw
+    };
+}
\ No newline at end of file
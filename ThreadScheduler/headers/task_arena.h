@@ -0,0 +1,125 @@
+#pragma once
+
+#include <future>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <functional>
+#include <string_view>
+#include <type_traits>
+#include <condition_variable>
+
+namespace jpd
+{
+    /*
+        Named Slice Of A ThreadPool (See ThreadPool::CreateArena)
+
+        Arenas Share The Pool's Worker Threads. Each Arena Runs At Most m_MaxConcurrency
+        Tasks At Once, And Idle Workers Pick The Arena With The Lowest Active Tasks / Weight,
+        So Busy Arenas Get Their Weighted Share While Idle Capacity Flows To Whoever Has Work
+
+        Weights Only Apply When A Worker Frees Up - Long Tasks Keep Their Workers. An Arena's
+        m_ReservedConcurrency Workers Are Kept Idle For It Instead, So Its Tasks Start Right
+        Away However Busy The Other Queues Are
+
+        **Note: WaitForAllTasks Called From A Worker Only Helps With This Arena's Tasks
+    */
+    class TaskArena final
+    {
+    public:
+
+        using VoidFunc = std::function<void()>;
+
+        TaskArena( ThreadPool&      Pool
+                 , std::string_view Name
+                 , const size_t     MaxConcurrency
+                 , const size_t     Weight
+                 , const size_t     ReservedConcurrency ) noexcept;
+
+        TaskArena(const TaskArena&) = delete;
+        TaskArena& operator=(const TaskArena&) = delete;
+
+        template < typename    Func
+                 , typename... T_Args
+                 , typename    ReturnType = std::invoke_result_t < std::decay_t<Func>, T_Args...> >
+        [[nodiscard]] inline
+        std::future<ReturnType> QueueFunction( Func&&      F
+                                             , T_Args&&... Args ) noexcept;
+
+        // Unlabelled Overloads Profile Under The Arena's Name
+        template < typename    Func
+                 , typename... T_Args
+                 , typename    ReturnType = std::invoke_result_t < std::decay_t<Func>, T_Args...> >
+        [[nodiscard]] inline
+        std::future<ReturnType> QueueFunction( const TaskLabel& Label
+                                             , Func&&           F
+                                             , T_Args&&...      Args ) noexcept;
+
+        template < typename    Func
+                 , typename... T_Args
+                 , typename    ReturnType = std::invoke_result_t<std::decay_t<Func>, size_t, size_t, T_Args...> >
+        [[nodiscard]] inline
+        GroupTasks<ReturnType> QueueAndPartitionLoop( const size_t StartIndex
+                                                    , const size_t EndIndex
+                                                    , const size_t PartitionCount
+                                                    , const size_t MinPartitionSize
+                                                    , Func&&       F
+                                                    , T_Args&&...  Args ) noexcept;
+
+        template < typename    Func
+                 , typename... T_Args
+                 , typename    ReturnType = std::invoke_result_t<std::decay_t<Func>, size_t, size_t, T_Args...> >
+        [[nodiscard]] inline
+        GroupTasks<ReturnType> QueueAndPartitionLoop( const TaskLabel& Label
+                                                    , const size_t     StartIndex
+                                                    , const size_t     EndIndex
+                                                    , const size_t     PartitionCount
+                                                    , const size_t     MinPartitionSize
+                                                    , Func&&           F
+                                                    , T_Args&&...      Args ) noexcept;
+
+        inline
+        void WaitForAllTasks(void) noexcept;
+
+        [[nodiscard]] inline
+        const std::string& GetName(void) const noexcept;
+
+        [[nodiscard]] inline
+        size_t GetMaxConcurrency(void) const noexcept;
+
+        [[nodiscard]] inline
+        size_t GetWeight(void) const noexcept;
+
+        [[nodiscard]] inline
+        size_t GetReservedConcurrency(void) const noexcept;
+
+        [[nodiscard]] inline
+        size_t GetTotalTaskCount(void) const noexcept;
+
+    private:
+
+        friend class ThreadPool;
+
+        [[nodiscard]] inline
+        bool HasCapacity(void) const noexcept;
+
+        // Runs Task While Recording That This Thread Is Inside One Of This Arena's Tasks
+        inline
+        void Execute(VoidFunc& Task) noexcept;
+
+
+        /*
+            Variables - Guarded By ThreadPool::m_MutexLock
+        */
+        ThreadPool&                 m_Pool;
+        const std::string           m_Name;
+        const size_t                m_MaxConcurrency;                                               // Maximum Tasks Of This Arena Running At Once
+        const size_t                m_Weight;                                                       // Share Of Worker Threads Relative To Other Busy Arenas
+        const size_t                m_ReservedConcurrency;                                          // Workers Left Idle For This Arena While It Runs Fewer Tasks - At Most m_MaxConcurrency
+        size_t                      m_ActiveTasks       = 0;                                        // Tasks Of This Arena Currently Executing
+        ThreadPool::TaskQueue       m_TaskQueue         = {};                                       // Tasks Of This Arena Waiting For A Worker
+        std::condition_variable     m_CVTaskCompleted   = {};                                       // Notified On Each Completion/Submission - Wakes WaitForAllTasks
+
+        static inline thread_local std::vector<const TaskArena*> t_RunningArenas = {};              // Arenas Of The Tasks On The Calling Thread's Stack - Excluded From Its Own Waits
+    };
+}
\ No newline at end of file
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace jpd
+{
+    /*
+        Identifies A Task Type For Profiling - Either A Static String Or A Precomputed Hash
+    */
+    struct TaskLabel final
+    {
+        const char* m_Name = nullptr;                                                               // Must Outlive The Pool - Typically A String Literal
+        uint64_t    m_Hash = 0;                                                                     // 0 Marks An Unlabeled Task
+
+        constexpr TaskLabel(void) noexcept = default;
+
+        constexpr TaskLabel(const char* Name) noexcept;
+
+        explicit constexpr TaskLabel(const uint64_t Hash) noexcept;
+
+        [[nodiscard]] static constexpr inline
+        uint64_t Hash(const char* Name) noexcept;
+    };
+
+    // Times Are Self Times - Tasks Run Nested Inside (e.g. By A Worker Helping In TaskArena::WaitForAllTasks) Are Recorded Under Their Own Path
+    struct TaskProfileEntry final
+    {
+        TaskLabel m_Label       = {};
+        uint64_t  m_Path        = 0;                                                                // This Label & The Labels Enclosing It On The Worker's Stack
+        uint64_t  m_ParentPath  = 0;                                                                // m_Path Of The Enclosing Task - 0 For Top-Level Tasks
+        uint64_t  m_Count       = 0;                                                                // Number Of Completed Tasks
+        uint64_t  m_WallNs      = 0;                                                                // Total Wall Clock Time (Nanoseconds)
+        uint64_t  m_CpuNs       = 0;                                                                // Total Thread CPU Time (Nanoseconds) - 0 Where Unsupported
+    };
+
+    /*
+        Per-Label Task Counts & Times, Gathered Per Worker Without Locks
+
+        Each Worker Owns A Fixed-Size Table Only It Writes To, So Recording Is A Handful Of
+        Relaxed Atomic Stores. Tables May Be Read Concurrently With Workers Through ForEachEntry
+
+        Samples Nest Per Thread - Begin/End Pairs Inside Another Pair Are Subtracted From The
+        Enclosing Sample, Which Keeps Only Its Self Time, And Are Keyed By Their Full Path
+
+        **Note: Snapshots & Reports Live In includes/task_profiler_includes.h
+        **Note: Disabled By Default - The Only Cost While Disabled Is One Relaxed Load Per Task
+    */
+    class TaskProfiler final
+    {
+    public:
+
+        struct Sample final
+        {
+            bool     m_Enabled      = false;
+            size_t   m_WorkerIndex  = 0;
+            size_t   m_SlotIndex    = 0;                                                            // TableSize If The Table Is Full - Timed But Not Recorded
+            uint64_t m_WallNs       = 0;
+            uint64_t m_CpuNs        = 0;
+        };
+
+        explicit TaskProfiler(const size_t WorkerCount) noexcept;
+
+        inline
+        void Enable(const bool Enabled = true) noexcept;
+
+        [[nodiscard]] inline
+        bool IsEnabled(void) const noexcept;
+
+        // Zeroes All Counters - Samples Recorded Concurrently May Be Lost
+        inline
+        void Reset(void) noexcept;
+
+        // Every Begin Must Be Matched By An End On The Same Thread, Innermost First
+        [[nodiscard]] inline
+        Sample Begin( const size_t     WorkerIndex
+                    , const TaskLabel& Label ) noexcept;
+
+        inline
+        void End(const Sample& Start) noexcept;
+
+        // Visits Every Recorded Label Of Every Worker As F(WorkerIndex, Entry) - Safe While Workers Record
+        template <typename Func>
+        inline
+        void ForEachEntry(Func&& F) const noexcept;
+
+        [[nodiscard]] static inline
+        uint64_t GetThreadCPUTime(void) noexcept;
+
+    private:
+
+        static constexpr size_t TableSize = 256;                                                    // Distinct Labels Per Worker - Power Of 2
+
+        struct alignas(CacheLineSize) Slot final
+        {
+            std::atomic_uint64_t     m_Hash   = 0;                                                  // Path Hash - 0 Marks An Empty Slot
+            std::atomic_uint64_t     m_Label  = 0;
+            std::atomic_uint64_t     m_Parent = 0;                                                  // Path Hash Of The Enclosing Sample
+            std::atomic<const char*> m_Name   = nullptr;
+            std::atomic_uint64_t     m_Count  = 0;
+            std::atomic_uint64_t     m_WallNs = 0;
+            std::atomic_uint64_t     m_CpuNs  = 0;
+        };
+
+        struct Frame final
+        {
+            uint64_t m_Path         = 0;
+            uint64_t m_ChildWallNs  = 0;                                                            // Inclusive Times Of Samples Nested Inside This One
+            uint64_t m_ChildCpuNs   = 0;
+        };
+
+        using WorkerTable = std::array<Slot, TableSize>;
+
+        [[nodiscard]] static constexpr inline
+        uint64_t ComputePath( const uint64_t ParentPath
+                            , const uint64_t LabelHash ) noexcept;
+
+        // Finds Or Claims The Slot Of Path - TableSize If The Table Is Full
+        [[nodiscard]] inline
+        size_t FindSlot( const size_t     WorkerIndex
+                       , const uint64_t   Path
+                       , const uint64_t   ParentPath
+                       , const TaskLabel& Label ) noexcept;
+
+
+        std::atomic_bool                m_Enabled       = false;
+        size_t                          m_WorkerCount   = 0;
+        std::unique_ptr<WorkerTable[]>  m_Tables        = nullptr;                                  // One Table Per Worker - Written Only By That Worker
+
+        static inline thread_local std::vector<Frame> t_Frames = {};                                // Samples Open On The Calling Thread - Innermost Last
+    };
+}
\ No newline at end of file
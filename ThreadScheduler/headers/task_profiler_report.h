@@ -0,0 +1,30 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <ostream>
+
+namespace jpd
+{
+    /*
+        Task Profiler Reports - Opt-In Through includes/task_profiler_includes.h
+    */
+    // Aggregated Across Workers, Sorted By CPU Time (Wall Time Where CPU Time Is Unsupported)
+    [[nodiscard]] inline
+    std::vector<TaskProfileEntry> SnapshotProfile( const TaskProfiler& Profiler ) noexcept;
+
+    inline
+    void PrintTopN( const TaskProfiler& Profiler
+                  , std::ostream&       Out
+                  , const size_t        Count = 10 ) noexcept;
+
+    // One "Worker N;Outer;Inner SelfCpuMicroseconds" Line Per Worker & Label Path - Input For flamegraph.pl
+    inline
+    void PrintFoldedStacks( const TaskProfiler& Profiler
+                          , std::ostream&       Out ) noexcept;
+
+    // Static Name If Available, Otherwise The Hash In Hex
+    [[nodiscard]] inline
+    std::string GetLabelName( const TaskLabel& Label ) noexcept;
+}
\ No newline at end of file
@@ -1,7 +1,29 @@
 #pragma once
 
+#include <list>
+#include <queue>
+#include <mutex>
+#include <atomic>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <ranges>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string_view>
+#include <type_traits>
+#include <condition_variable>
+
 namespace jpd
 {
+    class TaskArena;
+
+#if defined(__linux__)
+    class IOReactor;
+#endif
+
     class [[nodiscard]] ThreadPool final
     {
     public:
@@ -16,17 +38,78 @@ namespace jpd
 
         ~ThreadPool() noexcept;
 
+        // Process Wide Pool - Subsystems Share Its Workers Through Arenas Instead Of Creating Their Own Pools
+        [[nodiscard]] static inline
+        ThreadPool& GetGlobal(void) noexcept;
+
+        // Returns The Existing Arena Unchanged If Name Is Already Taken
+        [[nodiscard]] inline
+        TaskArena& CreateArena( std::string_view Name
+                              , const size_t     MaxConcurrency = 0
+                              , const size_t     Weight = 1
+                              , const size_t     ReservedConcurrency = 0 ) noexcept;
+
+        [[nodiscard]] inline
+        TaskArena* FindArena( std::string_view Name ) noexcept;
+
+#if defined(JPD_SCHEDULER_STRESS)
+        /*
+            Scheduling Stress Mode - See schedule_stress.h
+        */
+        inline
+        void SeedStress(const uint64_t Seed) noexcept;
+
+        inline
+        void BeginRecording(void) noexcept;
+
+        [[nodiscard]] inline
+        std::vector<uint64_t> EndRecording(void) noexcept;
+
+        inline
+        void BeginReplay(std::vector<uint64_t> TaskOrder) noexcept;
+
+        // Task IDs In The Order They Started During The Replay
+        [[nodiscard]] inline
+        std::vector<uint64_t> EndReplay(void) noexcept;
+#endif
+
         template < typename    Func
                  , typename... T_Args
                  , typename    ReturnType = std::invoke_result_t < std::decay_t<Func>, T_Args...> >
-        inline [[nodiscard]]
+        [[nodiscard]] inline
         std::future<ReturnType> QueueFunction( Func&&      F
                                              , T_Args&&... Args ) noexcept;
 
+        // Time Spent In The Task Is Attributed To Label While Profiling Is Enabled
+        template < typename    Func
+                 , typename... T_Args
+                 , typename    ReturnType = std::invoke_result_t < std::decay_t<Func>, T_Args...> >
+        [[nodiscard]] inline
+        std::future<ReturnType> QueueFunction( const TaskLabel& Label
+                                             , Func&&           F
+                                             , T_Args&&...      Args ) noexcept;
+
+        template < typename    Func
+                 , typename... T_Args
+                 , typename    ReturnType = std::invoke_result_t < std::decay_t<Func>, T_Args...> >
+        [[nodiscard]] inline
+        std::future<ReturnType> QueueFunctionOnWorker( const size_t WorkerIndex
+                                                     , Func&&       F
+                                                     , T_Args&&...  Args ) noexcept;
+
+        template < typename    Func
+                 , typename... T_Args
+                 , typename    ReturnType = std::invoke_result_t < std::decay_t<Func>, T_Args...> >
+        [[nodiscard]] inline
+        std::future<ReturnType> QueueFunctionOnWorker( const TaskLabel& Label
+                                                     , const size_t     WorkerIndex
+                                                     , Func&&           F
+                                                     , T_Args&&...      Args ) noexcept;
+
         template < typename    Func
                  , typename... T_Args
                  , typename    ReturnType = std::invoke_result_t<std::decay_t<Func>, size_t, size_t, T_Args...> >
-        inline [[nodiscard]]
+        [[nodiscard]] inline
         GroupTasks<ReturnType> QueueAndPartitionLoop( const size_t EndIndex
                                                     , const size_t PartitionCount
                                                     , const size_t MinPartitionSize
@@ -36,7 +119,7 @@ namespace jpd
         template < typename    Func
                  , typename... T_Args
                  , typename    ReturnType = std::invoke_result_t<std::decay_t<Func>, size_t, size_t, T_Args...> >
-        inline [[nodiscard]]
+        [[nodiscard]] inline
         GroupTasks<ReturnType> QueueAndPartitionLoop( const size_t StartIndex
                                                     , const size_t EndIndex
                                                     , const size_t PartitionCount
@@ -44,20 +127,154 @@ namespace jpd
                                                     , Func&&       F
                                                     , T_Args&&...  Args ) noexcept;
 
+        template < typename    Func
+                 , typename... T_Args
+                 , typename    ReturnType = std::invoke_result_t<std::decay_t<Func>, size_t, size_t, T_Args...> >
+        [[nodiscard]] inline
+        GroupTasks<ReturnType> QueueAndPartitionLoop( const TaskLabel& Label
+                                                    , const size_t     StartIndex
+                                                    , const size_t     EndIndex
+                                                    , const size_t     PartitionCount
+                                                    , const size_t     MinPartitionSize
+                                                    , Func&&           F
+                                                    , T_Args&&...      Args ) noexcept;
+
+        template < typename    Func
+                 , typename... T_Args
+                 , typename    ReturnType = std::invoke_result_t<std::decay_t<Func>, size_t, size_t, T_Args...> >
+        [[nodiscard]] inline
+        GroupTasks<ReturnType> QueueAndPartitionAlignedLoop( const size_t             StartIndex
+                                                           , const size_t             EndIndex
+                                                           , const size_t             PartitionCount
+                                                           , const size_t             MinPartitionSize
+                                                           , const PartitionAlignment Alignment
+                                                           , Func&&                   F
+                                                           , T_Args&&...              Args ) noexcept;
+
+        template < typename    Func
+                 , typename... T_Args
+                 , typename    ReturnType = std::invoke_result_t<std::decay_t<Func>, size_t, size_t, T_Args...> >
+        [[nodiscard]] inline
+        GroupTasks<ReturnType> QueueAndPartitionAlignedLoop( const TaskLabel&         Label
+                                                           , const size_t             StartIndex
+                                                           , const size_t             EndIndex
+                                                           , const size_t             PartitionCount
+                                                           , const size_t             MinPartitionSize
+                                                           , const PartitionAlignment Alignment
+                                                           , Func&&                   F
+                                                           , T_Args&&...              Args ) noexcept;
+
+        template < typename    Func
+                 , typename... T_Args
+                 , typename    ReturnType = std::invoke_result_t<std::decay_t<Func>, BlockedRange2D, T_Args...> >
+        [[nodiscard]] inline
+        GroupTasks<ReturnType> QueueAndPartitionLoop( const BlockedRange2D&    Range
+                                                    , const size_t             PartitionCount
+                                                    , const PartitionAlignment Alignment
+                                                    , Func&&                   F
+                                                    , T_Args&&...              Args ) noexcept;
+
+        template < typename    Func
+                 , typename... T_Args
+                 , typename    ReturnType = std::invoke_result_t<std::decay_t<Func>, BlockedRange2D, T_Args...> >
+        [[nodiscard]] inline
+        GroupTasks<ReturnType> QueueAndPartitionLoop( const TaskLabel&         Label
+                                                    , const BlockedRange2D&    Range
+                                                    , const size_t             PartitionCount
+                                                    , const PartitionAlignment Alignment
+                                                    , Func&&                   F
+                                                    , T_Args&&...              Args ) noexcept;
+
+        template < typename    Func
+                 , typename... T_Args
+                 , typename    ReturnType = std::invoke_result_t<std::decay_t<Func>, BlockedRange3D, T_Args...> >
+        [[nodiscard]] inline
+        GroupTasks<ReturnType> QueueAndPartitionLoop( const BlockedRange3D&    Range
+                                                    , const size_t             PartitionCount
+                                                    , const PartitionAlignment Alignment
+                                                    , Func&&                   F
+                                                    , T_Args&&...              Args ) noexcept;
+
+        template < typename    Func
+                 , typename... T_Args
+                 , typename    ReturnType = std::invoke_result_t<std::decay_t<Func>, BlockedRange3D, T_Args...> >
+        [[nodiscard]] inline
+        GroupTasks<ReturnType> QueueAndPartitionLoop( const TaskLabel&         Label
+                                                    , const BlockedRange3D&    Range
+                                                    , const size_t             PartitionCount
+                                                    , const PartitionAlignment Alignment
+                                                    , Func&&                   F
+                                                    , T_Args&&...              Args ) noexcept;
+
+        template < typename    Func
+                 , typename... T_Args
+                 , typename    ReturnType = std::invoke_result_t<std::decay_t<Func>, size_t, size_t, T_Args...> >
+        [[nodiscard]] inline
+        GroupTasks<ReturnType> QueueAndPartitionLoop( const size_t         StartIndex
+                                                    , const size_t         EndIndex
+                                                    , const size_t         PartitionCount
+                                                    , const size_t         MinPartitionSize
+                                                    , AffinityPartitioner& Partitioner
+                                                    , Func&&               F
+                                                    , T_Args&&...          Args ) noexcept;
+
+        template < typename    Func
+                 , typename... T_Args
+                 , typename    ReturnType = std::invoke_result_t<std::decay_t<Func>, size_t, size_t, T_Args...> >
+        [[nodiscard]] inline
+        GroupTasks<ReturnType> QueueAndPartitionLoop( const TaskLabel&     Label
+                                                    , const size_t         StartIndex
+                                                    , const size_t         EndIndex
+                                                    , const size_t         PartitionCount
+                                                    , const size_t         MinPartitionSize
+                                                    , AffinityPartitioner& Partitioner
+                                                    , Func&&               F
+                                                    , T_Args&&...          Args ) noexcept;
+
         inline
         void WaitForAllTasks(void) noexcept;
 
         inline
         void ResetThreads(const size_t ThreadCount = 0) noexcept;
 
-        inline [[nodiscard]]
+        [[nodiscard]] inline
         size_t GetTotalTaskCount( void ) const noexcept;
 
-        inline [[nodiscard]]
+        [[nodiscard]] inline
         size_t GetActiveTaskCount( void ) const noexcept;
 
+        [[nodiscard]] inline
+        size_t GetWorkerIndex( void ) const noexcept;
+
+        // Per-Label Task Counts & Times - Disabled Until GetProfiler().Enable() Is Called
+        [[nodiscard]] inline
+        TaskProfiler& GetProfiler( void ) noexcept;
+
+#if defined(__linux__)
+        // Created On First Use - Completions Are Delivered As Tasks/Futures Of This Pool
+        // **Note: Defined In includes/io_reactor_includes.h
+        [[nodiscard]] inline
+        IOReactor& GetIOReactor( void ) noexcept;
+#endif
+
     private:
 
+        friend class TaskArena;
+#if defined(__linux__)
+        friend class IOReactor;
+#endif
+
+        struct ScheduledTask final
+        {
+            VoidFunc m_Func   = {};
+            uint64_t m_TaskID = 0;                                                                  // Submission Order - Identifies The Task When Recording/Replaying
+        };
+
+        using TaskQueue = std::queue<ScheduledTask>;
+#if defined(__linux__)
+        using IOReactorHandle = std::unique_ptr<IOReactor, void(*)(IOReactor*)>;
+#endif
+
         /*
             Private Member Functions
         */
@@ -67,18 +284,56 @@ namespace jpd
         inline
         void DestroyThreads(void) noexcept;
 
+        template < typename    Func
+                 , typename... T_Args
+                 , typename    ReturnType = std::invoke_result_t < std::decay_t<Func>, T_Args...> >
+        [[nodiscard]] inline
+        std::future<ReturnType> QueueFunctionInto( TaskArena*       Arena
+                                                 , const size_t     WorkerIndex
+                                                 , const TaskLabel& Label
+                                                 , Func&&           F
+                                                 , T_Args&&...      Args ) noexcept;
+
         template < typename    Func
                  , typename... T_Args
                  , typename    ReturnType = std::invoke_result_t < std::decay_t<Func>, T_Args...> >
         inline
-        void QueueTask( Func&&      F
-                      , T_Args&&... Args ) noexcept;
+        void QueueTask( TaskArena*   Arena
+                      , const size_t WorkerIndex
+                      , Func&&       F
+                      , T_Args&&...  Args ) noexcept;
 
-        inline [[nodiscard]]
+        [[nodiscard]] inline
         size_t ComputeThreadCount(const size_t ThreadCount) noexcept;
 
         inline
-        void WorkerThread(void) noexcept;
+        void WorkerThread(const size_t WorkerIndex) noexcept;
+
+        [[nodiscard]] inline
+        TaskQueue* FindTaskQueue( const size_t WorkerIndex
+                                , TaskArena*&  Arena ) noexcept;
+
+        // Workers Held Back For Arenas Running Fewer Tasks Than They Reserve - Capped So One Worker Always Serves The Rest
+        [[nodiscard]] inline
+        size_t GetReservedIdleWorkers(void) const noexcept;
+
+        [[nodiscard]] inline
+        size_t GetIdleWorkerCount(void) const noexcept;
+
+        [[nodiscard]] inline
+        TaskArena* FindArenaUnlocked(std::string_view Name) noexcept;
+
+        [[nodiscard]] inline
+        bool IsTaskReady(const TaskQueue& Queue) const noexcept;
+
+        [[nodiscard]] inline
+        VoidFunc PopTask(TaskQueue& Queue) noexcept;
+
+        inline
+        void CompleteTask(TaskArena* Arena) noexcept;
+
+        [[nodiscard]] inline
+        size_t GetQueuedTaskCount(void) const noexcept;
 
 
         /*
@@ -86,34 +341,57 @@ namespace jpd
         */
         template <typename Container>
         requires( std::ranges::contiguous_range<Container> )
-        inline [[nodiscard]]
+        [[nodiscard]] inline
         std::vector<size_t> PartitionData( const Container& Data
                                          , const size_t PartitionCount ) noexcept;
 
-        inline [[nodiscard]]
+        [[nodiscard]] inline
         std::vector<size_t> PartitionData( const size_t DataCount
                                          , const size_t PartitionCount ) noexcept;
 
-        inline [[nodiscard]]
+        [[nodiscard]] inline
         std::vector<size_t> PartitionLoopIndices( size_t       StartIndex
                                                 , size_t       EndIndex
                                                 , const size_t PartitionCount
                                                 , const size_t MinimumPartitionSize = 0 ) noexcept;
 
+        [[nodiscard]] inline
+        std::vector<size_t> PartitionAlignedLoopIndices( size_t                   StartIndex
+                                                       , size_t                   EndIndex
+                                                       , const size_t             PartitionCount
+                                                       , const size_t             MinimumPartitionSize
+                                                       , const PartitionAlignment Alignment ) noexcept;
+
 
         /*
             Variables
         */
         size_t                          m_AvailableThreads  = std::thread::hardware_concurrency();  // Number Of Threads Allocated To Thread Scheduler
         size_t                          m_MinPartitionSize  = 25;                                   // Minimum Number Of Elements In Each Partition - Reduces Number Of Tasks If Unnecessary
-        std::mutex                      m_MutexLock         = {};                                   // Assists With Locking Of Data Accessed In Different Threads
+        mutable std::mutex              m_MutexLock         = {};                                   // Assists With Locking Of Data Accessed In Different Threads
         std::atomic_bool                m_Running           = false;                                // Controls Task Queue - Runs Task from m_TaskQueue If m_Running == True
-        std::atomic_bool                m_Waiting           = false;                                // Controls Task Queue - Halts All Tasks from m_TaskQueue If m_Waiting == True
+        std::atomic_int32_t             m_Waiting           = 0;                                    // Number Of Threads Inside WaitForAllTasks - Workers Notify m_CVTaskCompleted While Non-Zero
         std::atomic_bool                m_Paused            = false;                                // Controls Task Queue - Halts All Tasks (Only When Resetting Thread Pool)
-        std::atomic_int32_t             m_TotalTaskCount    = 0;                                    // Tracks Total Number Of Active Tasks - TaskQueue + CurrentlyExecuting
+        std::atomic_size_t              m_TotalTaskCount    = 0;                                    // Tracks Total Number Of Active Tasks - TaskQueue + CurrentlyExecuting
         std::condition_variable         m_CVNewTask         = {};                                   // Enables Worker Thread Whenever A Task Is Available And Running
         std::condition_variable         m_CVTaskCompleted   = {};                                   // Notifies Main Thread Each Time A Task Is Completed If User Is Waiting For Current Tasks - Unwaits When Queued Tasks Are Completed
-        std::queue<VoidFunc>            m_TaskQueue         = {};                                   // Stores Each Task Assigned To Thread Scheduler
+        TaskQueue                       m_TaskQueue         = {};                                   // Stores Each Task Assigned To Thread Scheduler
+        uint64_t                        m_NextTaskID        = 0;                                    // ID Given To The Next Queued Task - Guarded By m_MutexLock
+        size_t                          m_SharedActiveTasks = 0;                                    // Tasks From m_TaskQueue Currently Executing - Weighs The Shared Queue Against Arenas
+        std::list<TaskArena>            m_Arenas            = {};                                   // Named Arenas Sharing These Worker Threads
+        std::unique_ptr<TaskQueue[]>    m_WorkerQueues      = nullptr;                             // Stores Tasks Pinned To A Worker Thread - Other Workers Only Steal While The Owner Is Busy
+        std::unique_ptr<bool[]>         m_WorkerBusy        = nullptr;                              // Tracks Which Worker Threads Are Executing A Task - Guarded By m_MutexLock
         std::unique_ptr<std::thread[]>  m_Threads           = nullptr;                              // Stores All Worker Threads
+        TaskProfiler                    m_Profiler;                                                 // Per-Worker Label Statistics - Sized For The Largest Possible Worker Count
+#if defined(JPD_SCHEDULER_STRESS)
+        ScheduleStress                  m_Stress            = {};                                   // Seeded Yield Injection & Task Order Record/Replay
+#endif
+#if defined(__linux__)
+        std::once_flag                  m_IOReactorOnce     = {};                                   // Guards Lazy Creation Of m_IOReactor
+        IOReactorHandle                 m_IOReactor         = { nullptr, nullptr };                 // Completion Based I/O - Deleter Is Set On Creation So IOReactor Can Stay Incomplete Here
+#endif
+
+        static inline thread_local const ThreadPool*  t_CurrentPool   = nullptr;                     // Pool Owning The Calling Worker Thread
+        static inline thread_local size_t             t_WorkerIndex   = NoAffinity;                  // Index Of The Calling Worker Thread Within t_CurrentPool
     };
 }
\ No newline at end of file
@@ -0,0 +1,10 @@
+#pragma once
+
+// Opt-In - Completion Based I/O (Linux Only)
+#include "includes/thread_pool_includes.h"
+
+// Header Files
+#include "headers/io_reactor.h"
+
+// Inline Files
+#include "src/io_reactor_inline.h"
\ No newline at end of file
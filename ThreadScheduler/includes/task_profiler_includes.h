@@ -0,0 +1,10 @@
+#pragma once
+
+// Opt-In - Task Profiler Snapshots & Reports
+#include "includes/thread_pool_includes.h"
+
+// Header Files
+#include "headers/task_profiler_report.h"
+
+// Inline Files
+#include "src/task_profiler_report_inline.h"
\ No newline at end of file
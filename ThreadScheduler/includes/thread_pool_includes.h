@@ -1,10 +1,22 @@
 #pragma once
 
+// Macros & Concepts Used By The Headers Below
+#include "src/functional_tools_inline.h"
+
 // Header Files
+#include "headers/schedule_stress.h"
 #include "headers/group_tasks.h"
+#include "headers/partition_tasks.h"
+#include "headers/affinity_partitioner.h"
+#include "headers/task_profiler.h"
 #include "headers/thread_pool.h"
+#include "headers/task_arena.h"
 
 // Inline Files
-#include "src/functional_tools_inline.h"
+#include "src/schedule_stress_inline.h"
 #include "src/group_tasks_inline.h"
+#include "src/partition_tasks_inline.h"
+#include "src/affinity_partitioner_inline.h"
+#include "src/task_profiler_inline.h"
+#include "src/task_arena_inline.h"
 #include "src/thread_pool_inline.h"
\ No newline at end of file
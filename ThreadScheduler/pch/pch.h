@@ -6,6 +6,7 @@
 #include <span>
 #include <list>
 #include <array>
+#include <deque>
 #include <queue>
 #include <stack>
 #include <tuple>
@@ -24,11 +25,15 @@
 #include <future>
 #include <atomic>
 #include <chrono>
+#include <ctime>
+#include <cstdio>
 #include <atomic>
 #include <cstdint>
 #include <utility>
 #include <fstream>
 #include <cassert>
+#include <limits>
+#include <algorithm>
 #include <numeric>
 #include <concepts>
 #include <iostream>
@@ -37,4 +42,15 @@
 #include <functional>
 #include <filesystem>
 #include <type_traits>
-#include <condition_variable>
\ No newline at end of file
+#include <condition_variable>
+
+/*
+		Platform
+*/
+#if defined(__linux__)
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#endif
\ No newline at end of file
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cassert>
+
+namespace jpd
+{
+    inline
+    void AffinityPartitioner::Reset(void) noexcept
+    {
+        m_Boundaries.clear();
+        m_ChunkWorkers.clear();
+    }
+
+    [[nodiscard]] inline
+    size_t AffinityPartitioner::GetWorker(const size_t ChunkIndex) const noexcept
+    {
+        return ChunkIndex < m_ChunkWorkers.size() ? m_ChunkWorkers[ChunkIndex]
+                                                  : NoAffinity;
+    }
+
+    inline
+    void AffinityPartitioner::RecordWorker(const size_t ChunkIndex, const size_t WorkerIndex) noexcept
+    {
+        assert(ChunkIndex < m_ChunkWorkers.size());
+
+        // Stolen Chunks Keep Their Previous Owner If Executed Outside Of A Worker Thread
+        if (WorkerIndex != NoAffinity)
+        {
+            m_ChunkWorkers[ChunkIndex] = WorkerIndex;
+        }
+    }
+
+    [[nodiscard]] inline
+    size_t AffinityPartitioner::GetChunkCount(void) const noexcept
+    {
+        return m_ChunkWorkers.size();
+    }
+
+    inline
+    void AffinityPartitioner::Prepare(const std::vector<size_t>& Boundaries, const size_t WorkerCount) noexcept
+    {
+        assert(WorkerCount > 0);
+
+        if (Boundaries == m_Boundaries)
+        {
+            return;
+        }
+
+        m_Boundaries = Boundaries;
+        m_ChunkWorkers.resize(Boundaries.size() ? Boundaries.size() - 1 : 0);
+
+        for (size_t i = 0, max = m_ChunkWorkers.size(); i < max; ++i)
+        {
+            m_ChunkWorkers[i] = i % WorkerCount;
+        }
+    }
+}
\ No newline at end of file
@@ -1,3 +1,12 @@
+#pragma once
+
+#include <mutex>
+#include <tuple>
+#include <ostream>
+#include <typeinfo>
+#include <functional>
+#include <type_traits>
+
 #define REF(x)                 \
     std::ref(x)
 
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <cassert>
+#include <utility>
+
 namespace jpd
 {
     template <typename ReturnType>
@@ -14,7 +17,7 @@ namespace jpd
     }
 
     template <typename ReturnType>
-    inline [[nodiscard]]
+    [[nodiscard]] inline
     std::future<ReturnType>& GroupTasks<ReturnType>::GetFuture(const size_t Index) noexcept
     {
         assert(Index < m_Tasks.size());
@@ -23,7 +26,7 @@ namespace jpd
     }
 
     template <typename ReturnType>
-    inline [[nodiscard]]
+    [[nodiscard]] inline
     std::future<ReturnType>& GroupTasks<ReturnType>::operator[](const size_t Index) noexcept
     {
         return GetFuture(Index);
@@ -40,7 +43,7 @@ namespace jpd
     }*/
 
     template <typename ReturnType>
-    inline [[nodiscard]]
+    [[nodiscard]] inline
     std::vector<ReturnType> GroupTasks<ReturnType>::GetResults(void) noexcept requires( NotVoid_T<ReturnType> )
     {
         std::vector<ReturnType> Results(m_Tasks.size());
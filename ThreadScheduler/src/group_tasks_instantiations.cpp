@@ -0,0 +1,14 @@
+#include "includes/thread_pool_includes.h"
+
+/*
+    Explicit Instantiations - Matches The extern template Declarations In headers/group_tasks.h
+*/
+namespace jpd
+{
+    template class GroupTasks<void>;
+    template class GroupTasks<bool>;
+    template class GroupTasks<int>;
+    template class GroupTasks<size_t>;
+    template class GroupTasks<float>;
+    template class GroupTasks<double>;
+}
\ No newline at end of file
@@ -0,0 +1,587 @@
+#pragma once
+
+#if defined(__linux__)
+
+#include <array>
+#include <memory>
+#include <cassert>
+#include <utility>
+#include <algorithm>
+
+namespace jpd
+{
+    /*
+        Thread Pool Access
+    */
+    [[nodiscard]] inline
+    IOReactor& ThreadPool::GetIOReactor(void) noexcept
+    {
+        std::call_once(m_IOReactorOnce, [this]
+                                        {
+                                            m_IOReactor = { new IOReactor(*this), [](IOReactor* Reactor){ delete Reactor; } };
+                                        });
+        return *m_IOReactor;
+    }
+
+
+
+
+    /*
+        Public Member Functions
+    */
+    inline
+    IOReactor::IOReactor(ThreadPool& Pool) noexcept :
+        m_Pool{ Pool }
+    ,   m_EpollFD{ epoll_create1(EPOLL_CLOEXEC) }
+    ,   m_WakeFD{ eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK) }
+    {
+        assert(m_EpollFD >= 0 && m_WakeFD >= 0);
+
+        epoll_event WakeEvent{ .events = EPOLLIN, .data = { .fd = m_WakeFD } };
+        epoll_ctl(m_EpollFD, EPOLL_CTL_ADD, m_WakeFD, &WakeEvent);
+
+#if defined(JPD_IO_URING)
+        SetupFileRing();
+#endif
+
+        m_Running = true;
+        m_Thread  = std::thread(&IOReactor::ReactorThread, this);
+    }
+
+    inline
+    IOReactor::~IOReactor() noexcept
+    {
+        m_Running = false;
+        Wake();
+        m_Thread.join();
+
+#if defined(JPD_IO_URING)
+        TeardownFileRing();
+#endif
+        close(m_WakeFD);
+        close(m_EpollFD);
+    }
+
+    [[nodiscard]] inline
+    std::future<IOResult> IOReactor::AsyncRead(const int FileDescriptor, std::span<std::byte> Buffer, const int64_t Offset) noexcept
+    {
+        return SubmitForFuture({ .m_Type = IOOperation::Read, .m_FileDescriptor = FileDescriptor, .m_Buffer = Buffer.data(), .m_Size = Buffer.size(), .m_Offset = Offset, .m_Events = EPOLLIN });
+    }
+
+    [[nodiscard]] inline
+    std::future<IOResult> IOReactor::AsyncWrite(const int FileDescriptor, std::span<const std::byte> Buffer, const int64_t Offset) noexcept
+    {
+        return SubmitForFuture({ .m_Type = IOOperation::Write, .m_FileDescriptor = FileDescriptor, .m_Buffer = const_cast<std::byte*>(Buffer.data()), .m_Size = Buffer.size(), .m_Offset = Offset, .m_Events = EPOLLOUT });
+    }
+
+    [[nodiscard]] inline
+    std::future<IOResult> IOReactor::AsyncPoll(const int FileDescriptor, const uint32_t Events) noexcept
+    {
+        return SubmitForFuture({ .m_Type = IOOperation::Poll, .m_FileDescriptor = FileDescriptor, .m_Events = Events });
+    }
+
+    template <typename Func>
+    inline
+    void IOReactor::AsyncRead(const int FileDescriptor, std::span<std::byte> Buffer, const int64_t Offset, Func&& OnComplete) noexcept
+    {
+        SubmitForTask({ .m_Type = IOOperation::Read, .m_FileDescriptor = FileDescriptor, .m_Buffer = Buffer.data(), .m_Size = Buffer.size(), .m_Offset = Offset, .m_Events = EPOLLIN }
+                     , std::forward<Func>(OnComplete));
+    }
+
+    template <typename Func>
+    inline
+    void IOReactor::AsyncWrite(const int FileDescriptor, std::span<const std::byte> Buffer, const int64_t Offset, Func&& OnComplete) noexcept
+    {
+        SubmitForTask({ .m_Type = IOOperation::Write, .m_FileDescriptor = FileDescriptor, .m_Buffer = const_cast<std::byte*>(Buffer.data()), .m_Size = Buffer.size(), .m_Offset = Offset, .m_Events = EPOLLOUT }
+                     , std::forward<Func>(OnComplete));
+    }
+
+    template <typename Func>
+    inline
+    void IOReactor::AsyncPoll(const int FileDescriptor, const uint32_t Events, Func&& OnComplete) noexcept
+    {
+        SubmitForTask({ .m_Type = IOOperation::Poll, .m_FileDescriptor = FileDescriptor, .m_Events = Events }
+                     , std::forward<Func>(OnComplete));
+    }
+
+
+
+
+    /*
+        Private Member Functions
+    */
+    inline
+    void IOReactor::Submit(Operation Op) noexcept
+    {
+        BEGIN_SCOPE_LOCK(m_MutexLock);
+            m_Submissions.push_back(std::move(Op));
+        END_SCOPE_LOCK()
+
+        Wake();
+    }
+
+    [[nodiscard]] inline
+    std::future<IOResult> IOReactor::SubmitForFuture(Operation Op) noexcept
+    {
+        auto ResultPromise = std::make_shared<std::promise<IOResult>>();
+        auto ResultFuture  = ResultPromise->get_future();
+
+        // Fulfilled Directly On The Reactor Thread - Waking The Waiter Is Cheaper Than Queuing A Task
+        Op.m_OnComplete = [ResultPromise](IOResult Result)
+                          {
+                              ResultPromise->set_value(Result);
+                          };
+        Submit(std::move(Op));
+
+        return ResultFuture;
+    }
+
+    template <typename Func>
+    inline
+    void IOReactor::SubmitForTask(Operation Op, Func&& OnComplete) noexcept
+    {
+        // Queued Like Any Other Task - Exceptions Are Caught By The Task Wrapper Instead Of Escaping The Worker
+        Op.m_OnComplete = [this, Callback = std::forward<Func>(OnComplete)](IOResult Result)
+                          {
+                              (void)m_Pool.QueueFunctionInto( nullptr
+                                                            , NoAffinity
+                                                            , TaskLabel{ "IOReactor" }
+                                                            , Callback
+                                                            , Result );
+                          };
+        Submit(std::move(Op));
+    }
+
+    inline
+    void IOReactor::ReactorThread(void) noexcept
+    {
+        std::array<epoll_event, 64> Events;
+
+        // Pipes Have No MSG_NOSIGNAL - Keep SIGPIPE Pending On This Thread So TryComplete Can Discard It
+        sigset_t PipeSignal;
+        sigemptyset(&PipeSignal);
+        sigaddset(&PipeSignal, SIGPIPE);
+        pthread_sigmask(SIG_BLOCK, &PipeSignal, nullptr);
+
+        while (m_Running)
+        {
+            const int EventCount = epoll_wait(m_EpollFD, Events.data(), static_cast<int>(Events.size()), -1);
+
+            for (int i = 0; i < EventCount; ++i)
+            {
+                if (Events[i].data.fd == m_WakeFD)
+                {
+                    uint64_t WakeCount;
+                    [[maybe_unused]] auto Drained = read(m_WakeFD, &WakeCount, sizeof(WakeCount));
+                    continue;
+                }
+#if defined(JPD_IO_URING)
+                if (Events[i].data.fd == m_Ring.m_FD)
+                {
+                    ReapFileCompletions();
+                    continue;
+                }
+#endif
+                Dispatch(Events[i].data.fd, Events[i].events);
+            }
+
+            std::vector<Operation> Submissions;
+            BEGIN_SCOPE_LOCK(m_MutexLock);
+                Submissions.swap(m_Submissions);
+            END_SCOPE_LOCK()
+
+            for (auto& Op : Submissions)
+            {
+                Register(std::move(Op));
+            }
+        }
+
+        // Cancel Everything Still Outstanding
+        BEGIN_SCOPE_LOCK(m_MutexLock);
+            for (auto& Op : m_Submissions)
+            {
+                m_Pending[Op.m_FileDescriptor].push_back(std::move(Op));
+            }
+            m_Submissions.clear();
+        END_SCOPE_LOCK()
+
+#if defined(JPD_IO_URING)
+        for (auto& Op : m_FileBacklog)
+        {
+            Op.m_OnComplete(IOResult{ .m_Error = ECANCELED });
+        }
+        m_FileBacklog.clear();
+
+        // The Kernel Still Writes Into In-Flight Buffers - Wait Them Out Rather Than Cancel
+        while (!m_FileInFlight.empty())
+        {
+            syscall(__NR_io_uring_enter, m_Ring.m_FD, 0, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+            ReapFileCompletions();
+        }
+#endif
+
+        for (auto& [FileDescriptor, Operations] : m_Pending)
+        {
+            epoll_ctl(m_EpollFD, EPOLL_CTL_DEL, FileDescriptor, nullptr);
+            for (auto& Op : Operations)
+            {
+                Op.m_OnComplete(IOResult{ .m_Error = ECANCELED });
+            }
+        }
+        m_Pending.clear();
+    }
+
+    inline
+    void IOReactor::Register(Operation Op) noexcept
+    {
+        const int FileDescriptor = Op.m_FileDescriptor;
+        auto& Operations = m_Pending[FileDescriptor];
+
+        if (Operations.empty())
+        {
+            epoll_event Event{ .events = Op.m_Events, .data = { .fd = FileDescriptor } };
+            if (epoll_ctl(m_EpollFD, EPOLL_CTL_ADD, FileDescriptor, &Event) != 0)
+            {
+                const int Error = errno;
+                m_Pending.erase(FileDescriptor);
+
+                // Regular Files Are Always "Ready" To epoll But Still Block On Disk - Never Issue Their Syscalls Here
+                if (Error == EPERM && Op.m_Type != IOOperation::Poll)
+                {
+                    SubmitFile(std::move(Op));
+                }
+                else if (Error == EPERM)
+                {
+                    Op.m_OnComplete(IOResult{ .m_Events = Op.m_Events });
+                }
+                else
+                {
+                    Op.m_OnComplete(IOResult{ .m_Error = Error });
+                }
+                return;
+            }
+
+            const int Flags = fcntl(FileDescriptor, F_GETFL);
+            if (Flags >= 0 && !(Flags & O_NONBLOCK))
+            {
+                fcntl(FileDescriptor, F_SETFL, Flags | O_NONBLOCK);
+            }
+        }
+
+        if (Op.m_Type == IOOperation::Write)
+        {
+            struct stat Status;
+            Op.m_IsSocket = fstat(FileDescriptor, &Status) == 0 && S_ISSOCK(Status.st_mode);
+        }
+
+        Operations.push_back(std::move(Op));
+        UpdateInterest(FileDescriptor);
+    }
+
+    inline
+    void IOReactor::Dispatch(const int FileDescriptor, const uint32_t ReadyEvents) noexcept
+    {
+        auto Iterator = m_Pending.find(FileDescriptor);
+        if (Iterator == m_Pending.end())
+        {
+            return;
+        }
+
+        // Errors/Hang Ups Complete Every Operation So Callers Observe EOF/EPIPE
+        auto& Operations = Iterator->second;
+        const uint32_t Terminal = ReadyEvents & (EPOLLERR | EPOLLHUP);
+
+        // Operations On The Same Descriptor Complete In Submission Order Per Direction
+        std::vector<std::pair<CompletionFunc, IOResult>> Completed;
+        bool ReadBlocked = false, WriteBlocked = false;
+        for (auto Op = Operations.begin(); Op != Operations.end(); )
+        {
+            bool& Blocked = (Op->m_Events & EPOLLOUT) ? WriteBlocked : ReadBlocked;
+            IOResult Result{};
+
+            if (!Blocked && ((Op->m_Events & ReadyEvents) || Terminal) && TryComplete(*Op, ReadyEvents, Result))
+            {
+                Completed.emplace_back(std::move(Op->m_OnComplete), Result);
+                Op = Operations.erase(Op);
+            }
+            else
+            {
+                Blocked = true;
+                ++Op;
+            }
+        }
+
+        // Deregister Before Notifying - The Caller May Close (And The OS Reuse) The Descriptor Right Away
+        UpdateInterest(FileDescriptor);
+
+        for (auto& [OnComplete, Result] : Completed)
+        {
+            OnComplete(Result);
+        }
+    }
+
+    inline
+    void IOReactor::UpdateInterest(const int FileDescriptor) noexcept
+    {
+        auto& Operations = m_Pending[FileDescriptor];
+
+        if (Operations.empty())
+        {
+            epoll_ctl(m_EpollFD, EPOLL_CTL_DEL, FileDescriptor, nullptr);
+            m_Pending.erase(FileDescriptor);
+            return;
+        }
+
+        epoll_event Event{ .events = 0, .data = { .fd = FileDescriptor } };
+        for (const auto& Op : Operations)
+        {
+            Event.events |= Op.m_Events;
+        }
+        epoll_ctl(m_EpollFD, EPOLL_CTL_MOD, FileDescriptor, &Event);
+    }
+
+    [[nodiscard]] inline
+    bool IOReactor::TryComplete(Operation& Op, const uint32_t ReadyEvents, IOResult& Result) noexcept
+    {
+        switch (Op.m_Type)
+        {
+        case IOOperation::Read:
+            Result.m_Bytes = Op.m_Offset < 0 ? read(Op.m_FileDescriptor, Op.m_Buffer, Op.m_Size)
+                                             : pread(Op.m_FileDescriptor, Op.m_Buffer, Op.m_Size, Op.m_Offset);
+            break;
+        case IOOperation::Write:
+            if (Op.m_IsSocket)
+            {
+                Result.m_Bytes = send(Op.m_FileDescriptor, Op.m_Buffer, Op.m_Size, MSG_NOSIGNAL);
+            }
+            else
+            {
+                Result.m_Bytes = Op.m_Offset < 0 ? write(Op.m_FileDescriptor, Op.m_Buffer, Op.m_Size)
+                                                 : pwrite(Op.m_FileDescriptor, Op.m_Buffer, Op.m_Size, Op.m_Offset);
+            }
+            break;
+        case IOOperation::Poll:
+            Result.m_Events = ReadyEvents;
+            break;
+        }
+
+        if (Result.m_Bytes < 0)
+        {
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+            {
+                return false;
+            }
+            Result.m_Error = errno;
+            Result.m_Bytes = 0;
+
+            // Broken Pipe - Consume The SIGPIPE Blocked On The Reactor Thread Before It Is Ever Unblocked
+            if (Result.m_Error == EPIPE && !Op.m_IsSocket)
+            {
+                sigset_t PipeSignal;
+                sigemptyset(&PipeSignal);
+                sigaddset(&PipeSignal, SIGPIPE);
+
+                const timespec NoWait{};
+                (void)sigtimedwait(&PipeSignal, nullptr, &NoWait);
+            }
+        }
+
+        return true;
+    }
+
+    inline
+    void IOReactor::Wake(void) noexcept
+    {
+        const uint64_t One = 1;
+        [[maybe_unused]] auto Written = write(m_WakeFD, &One, sizeof(One));
+    }
+
+
+
+
+    /*
+        Regular File I/O
+    */
+    inline
+    void IOReactor::SubmitFile(Operation Op) noexcept
+    {
+#if defined(JPD_IO_URING)
+        if (m_Ring.m_FD >= 0)
+        {
+            m_FileBacklog.push_back(std::move(Op));
+            FlushFileBacklog();
+            return;
+        }
+#endif
+
+        // No io_uring - Block A Worker Instead, So The Reactor Keeps Serving Pipes & Sockets
+        (void)m_Pool.QueueFunctionInto( nullptr
+                                      , NoAffinity
+                                      , TaskLabel{ "IOReactor" }
+                                      , [Op = std::move(Op)]() mutable
+                                        {
+                                            IOResult Result{};
+                                            [[maybe_unused]] bool Completed = TryComplete(Op, Op.m_Events, Result);
+                                            Op.m_OnComplete(Result);
+                                        } );
+    }
+
+#if defined(JPD_IO_URING)
+    inline
+    void IOReactor::SetupFileRing(void) noexcept
+    {
+        io_uring_params Params{};
+        m_Ring.m_FD = static_cast<int>(syscall(__NR_io_uring_setup, File_Ring_Entries, &Params));
+        if (m_Ring.m_FD < 0)
+        {
+            return;
+        }
+
+        // Offset -1 (Current File Position) Needs IORING_FEAT_RW_CUR_POS, Which Arrived With IORING_OP_READ/WRITE
+        if (!(Params.features & IORING_FEAT_RW_CUR_POS))
+        {
+            TeardownFileRing();
+            return;
+        }
+
+        m_Ring.m_Entries   = Params.sq_entries;
+        m_Ring.m_SQMapSize = Params.sq_off.array + Params.sq_entries * sizeof(uint32_t);
+        m_Ring.m_CQMapSize = Params.cq_off.cqes + Params.cq_entries * sizeof(io_uring_cqe);
+
+        const bool SingleMap = Params.features & IORING_FEAT_SINGLE_MMAP;
+        if (SingleMap)
+        {
+            m_Ring.m_SQMapSize = m_Ring.m_CQMapSize = std::max(m_Ring.m_SQMapSize, m_Ring.m_CQMapSize);
+        }
+
+        m_Ring.m_SQMap = mmap(nullptr, m_Ring.m_SQMapSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_Ring.m_FD, IORING_OFF_SQ_RING);
+        m_Ring.m_CQMap = SingleMap ? m_Ring.m_SQMap
+                                   : mmap(nullptr, m_Ring.m_CQMapSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_Ring.m_FD, IORING_OFF_CQ_RING);
+        void* SQEs     = mmap(nullptr, Params.sq_entries * sizeof(io_uring_sqe), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_Ring.m_FD, IORING_OFF_SQES);
+
+        if (m_Ring.m_SQMap == MAP_FAILED || m_Ring.m_CQMap == MAP_FAILED || SQEs == MAP_FAILED)
+        {
+            if (SQEs != MAP_FAILED)
+            {
+                munmap(SQEs, Params.sq_entries * sizeof(io_uring_sqe));
+            }
+            TeardownFileRing();
+            return;
+        }
+
+        auto* SQ = static_cast<char*>(m_Ring.m_SQMap);
+        auto* CQ = static_cast<char*>(m_Ring.m_CQMap);
+        m_Ring.m_SQEs    = static_cast<io_uring_sqe*>(SQEs);
+        m_Ring.m_SQHead  = reinterpret_cast<uint32_t*>(SQ + Params.sq_off.head);
+        m_Ring.m_SQTail  = reinterpret_cast<uint32_t*>(SQ + Params.sq_off.tail);
+        m_Ring.m_SQMask  = reinterpret_cast<uint32_t*>(SQ + Params.sq_off.ring_mask);
+        m_Ring.m_SQArray = reinterpret_cast<uint32_t*>(SQ + Params.sq_off.array);
+        m_Ring.m_CQHead  = reinterpret_cast<uint32_t*>(CQ + Params.cq_off.head);
+        m_Ring.m_CQTail  = reinterpret_cast<uint32_t*>(CQ + Params.cq_off.tail);
+        m_Ring.m_CQMask  = reinterpret_cast<uint32_t*>(CQ + Params.cq_off.ring_mask);
+        m_Ring.m_CQEs    = reinterpret_cast<io_uring_cqe*>(CQ + Params.cq_off.cqes);
+
+        // The Ring Turns Readable Once Completions Are Posted - The Reactor Reaps Them Like Any Other Event
+        epoll_event RingEvent{ .events = EPOLLIN, .data = { .fd = m_Ring.m_FD } };
+        if (epoll_ctl(m_EpollFD, EPOLL_CTL_ADD, m_Ring.m_FD, &RingEvent) != 0)
+        {
+            TeardownFileRing();
+        }
+    }
+
+    inline
+    void IOReactor::TeardownFileRing(void) noexcept
+    {
+        if (m_Ring.m_SQEs)
+        {
+            munmap(m_Ring.m_SQEs, m_Ring.m_Entries * sizeof(io_uring_sqe));
+        }
+        if (m_Ring.m_CQMap != MAP_FAILED && m_Ring.m_CQMap != m_Ring.m_SQMap)
+        {
+            munmap(m_Ring.m_CQMap, m_Ring.m_CQMapSize);
+        }
+        if (m_Ring.m_SQMap != MAP_FAILED)
+        {
+            munmap(m_Ring.m_SQMap, m_Ring.m_SQMapSize);
+        }
+        if (m_Ring.m_FD >= 0)
+        {
+            close(m_Ring.m_FD);
+        }
+
+        m_Ring = IOFileRing{};
+    }
+
+    inline
+    void IOReactor::FlushFileBacklog(void) noexcept
+    {
+        // Reactor Thread Is The Only Producer - Only The Kernel Moves m_SQHead
+        const uint32_t Tail = *m_Ring.m_SQTail;
+        uint32_t       Added = 0;
+
+        // At Most m_Entries In Flight - The Completion Queue (2x Entries) Can Never Overflow
+        for (; !m_FileBacklog.empty() && m_FileInFlight.size() < m_Ring.m_Entries; ++Added)
+        {
+            Operation&     Op    = m_FileBacklog.front();
+            const uint32_t Index = (Tail + Added) & *m_Ring.m_SQMask;
+
+            io_uring_sqe& Entry = m_Ring.m_SQEs[Index];
+            Entry           = io_uring_sqe{};
+            Entry.opcode    = Op.m_Type == IOOperation::Read ? IORING_OP_READ : IORING_OP_WRITE;
+            Entry.fd        = Op.m_FileDescriptor;
+            Entry.addr      = reinterpret_cast<uint64_t>(Op.m_Buffer);
+            Entry.len       = static_cast<uint32_t>(std::min<size_t>(Op.m_Size, UINT32_MAX));
+            Entry.off       = static_cast<uint64_t>(Op.m_Offset);                                    // -1 Uses The Current File Position
+            Entry.user_data = m_NextFileToken;
+            m_Ring.m_SQArray[Index] = Index;
+
+            m_FileInFlight.emplace(m_NextFileToken++, std::move(Op));
+            m_FileBacklog.pop_front();
+        }
+
+        if (Added)
+        {
+            std::atomic_ref<uint32_t>(*m_Ring.m_SQTail).store(Tail + Added, std::memory_order_release);
+        }
+
+        // Includes Entries A Previous (Interrupted) io_uring_enter Left Unconsumed
+        const uint32_t Unsubmitted = Tail + Added - std::atomic_ref<uint32_t>(*m_Ring.m_SQHead).load(std::memory_order_acquire);
+        if (Unsubmitted)
+        {
+            syscall(__NR_io_uring_enter, m_Ring.m_FD, Unsubmitted, 0, 0, nullptr, 0);
+        }
+    }
+
+    inline
+    void IOReactor::ReapFileCompletions(void) noexcept
+    {
+        std::vector<std::pair<CompletionFunc, IOResult>> Completed;
+
+        uint32_t       Head = *m_Ring.m_CQHead;
+        const uint32_t Tail = std::atomic_ref<uint32_t>(*m_Ring.m_CQTail).load(std::memory_order_acquire);
+        for (; Head != Tail; ++Head)
+        {
+            const io_uring_cqe& Entry = m_Ring.m_CQEs[Head & *m_Ring.m_CQMask];
+
+            auto Iterator = m_FileInFlight.find(Entry.user_data);
+            assert(Iterator != m_FileInFlight.end());
+
+            Completed.emplace_back( std::move(Iterator->second.m_OnComplete)
+                                  , Entry.res < 0 ? IOResult{ .m_Error = -Entry.res }
+                                                  : IOResult{ .m_Bytes = Entry.res } );
+            m_FileInFlight.erase(Iterator);
+        }
+        std::atomic_ref<uint32_t>(*m_Ring.m_CQHead).store(Head, std::memory_order_release);
+
+        // Freed Slots Go To The Backlog Before Callers Can Queue More
+        FlushFileBacklog();
+
+        for (auto& [OnComplete, Result] : Completed)
+        {
+            OnComplete(Result);
+        }
+    }
+#endif
+}
+
+#endif
\ No newline at end of file
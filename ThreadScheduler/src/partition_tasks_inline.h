@@ -0,0 +1,161 @@
+#pragma once
+
+#include <cassert>
+#include <numeric>
+#include <algorithm>
+
+namespace jpd
+{
+    /*
+        Partition Alignment
+    */
+    [[nodiscard]] constexpr inline
+    size_t PartitionAlignment::GetGranularity(void) const noexcept
+    {
+        assert(m_ElementSize > 0 && m_Alignment > 0);
+
+        // Smallest Element Count Whose Byte Size Is A Multiple Of m_Alignment
+        return m_Alignment / std::gcd(m_Alignment, m_ElementSize);
+    }
+
+    template <typename T>
+    [[nodiscard]] constexpr inline
+    PartitionAlignment AlignTo(const size_t Alignment) noexcept
+    {
+        return PartitionAlignment{ sizeof(T), Alignment };
+    }
+
+    template <typename T>
+    [[nodiscard]] inline
+    PartitionAlignment AlignTo(const T* Base, const size_t Alignment) noexcept
+    {
+        PartitionAlignment Result{ sizeof(T), Alignment };
+        const uintptr_t    Address = reinterpret_cast<uintptr_t>(Base);
+
+        // Aligned Indexes Repeat Every Granularity Elements - If None Exists Within One Period, None Ever Will (e.g. An Odd Address Of 8-Byte Elements)
+        for (size_t i = 0, Granularity = Result.GetGranularity(); i < Granularity; ++i)
+        {
+            if ((Address + i * sizeof(T)) % Alignment == 0)
+            {
+                Result.m_AlignedIndex = i;
+                break;
+            }
+        }
+
+        return Result;
+    }
+
+
+
+
+    /*
+        Blocked Ranges
+    */
+    [[nodiscard]] constexpr inline
+    size_t BlockedRange::Size(void) const noexcept
+    {
+        return m_End > m_Begin ? m_End - m_Begin
+                               : 0;
+    }
+
+    [[nodiscard]] constexpr inline
+    bool BlockedRange::Empty(void) const noexcept
+    {
+        return Size() == 0;
+    }
+
+
+
+
+    /*
+        Partition Helper Functions
+    */
+    [[nodiscard]] constexpr inline
+    size_t DivideRoundUp(const size_t Numerator, const size_t Denominator) noexcept
+    {
+        assert(Denominator > 0);
+
+        // Integer Only - Exact For The Full 64-Bit Range, Unlike Float Division Past 2^24
+        return Numerator / Denominator + (Numerator % Denominator != 0);
+    }
+
+    [[nodiscard]] constexpr inline
+    size_t RoundUpToMultiple(const size_t Value, const size_t Multiple) noexcept
+    {
+        return DivideRoundUp(Value, Multiple) * Multiple;
+    }
+
+    [[nodiscard]] inline
+    std::vector<size_t> PartitionRange(const size_t Begin, const size_t End, const size_t PartitionCount, const size_t MinimumPartitionSize, const size_t Granularity, const size_t AlignedIndex) noexcept
+    {
+        assert(Begin <= End && PartitionCount > 0 && Granularity > 0);
+
+        const size_t DataCount = End - Begin;
+
+        // Nothing To Partition - No Chunks
+        if (DataCount == 0)
+        {
+            return { Begin };
+        }
+
+        // Chunk Size Is A Multiple Of Granularity So Every Inner Boundary Stays Aligned
+        const size_t BlockSize = RoundUpToMultiple( std::max( MinimumPartitionSize
+                                                            , DivideRoundUp(DataCount, PartitionCount) )
+                                                  , Granularity );
+
+        // First Inner Boundary Is The First Aligned Index At Least One Block After Begin
+        const size_t Phase         = AlignedIndex % Granularity;
+        const size_t FirstBoundary = Begin + (Phase + Granularity - Begin % Granularity) % Granularity;
+
+        std::vector<size_t> Boundaries{ Begin };
+        Boundaries.reserve(DataCount / BlockSize + 2);
+
+        for (size_t Boundary = FirstBoundary + BlockSize; Boundary < End && Boundary > Boundaries.back(); Boundary += BlockSize)
+        {
+            Boundaries.push_back(Boundary);
+        }
+        Boundaries.push_back(End);
+
+        // Returns A Vector Of Chunk Boundaries - Chunk i Is [Boundaries[i], Boundaries[i + 1])
+        return Boundaries;
+    }
+
+    template <size_t N>
+    [[nodiscard]] inline
+    std::array<size_t, N> ComputeTileCounts(const std::array<size_t, N>& Extents, const std::array<size_t, N>& GrainSizes, const size_t PartitionCount) noexcept
+    {
+        std::array<size_t, N> TileCounts;
+        TileCounts.fill(1);
+
+        size_t TotalTiles = 1;
+        while (TotalTiles < PartitionCount)
+        {
+            // Split The Dimension With The Largest Tile Extent That Can Still Respect Its Grain Size
+            // Without Pushing The Total Past PartitionCount - Ties Go To The Outer Dimension To Keep Tiles Contiguous In Memory
+            size_t SplitDimension = N;
+            size_t LargestExtent  = 0;
+
+            for (size_t i = 0; i < N; ++i)
+            {
+                const size_t TileExtent = Extents[i] / TileCounts[i];
+                if ( TileExtent > LargestExtent
+                  && Extents[i] / (TileCounts[i] + 1) >= std::max<size_t>(GrainSizes[i], 1)
+                  && TotalTiles / TileCounts[i] * (TileCounts[i] + 1) <= PartitionCount )
+                {
+                    SplitDimension = i;
+                    LargestExtent  = TileExtent;
+                }
+            }
+
+            if (SplitDimension == N)
+            {
+                break;
+            }
+
+            TotalTiles = TotalTiles / TileCounts[SplitDimension] * (TileCounts[SplitDimension] + 1);
+            ++TileCounts[SplitDimension];
+        }
+
+        return TileCounts;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <utility>
+
+namespace jpd
+{
+    /*
+        Yield Injection
+    */
+    inline
+    void ScheduleStress::Seed(const uint64_t Seed) noexcept
+    {
+        m_Seed = Seed;
+        NewEpoch();
+    }
+
+    inline
+    void ScheduleStress::Inject(const StressPoint Point, const size_t WorkerIndex) noexcept
+    {
+        const uint64_t Seed = m_Seed;
+        if (Seed == 0)
+        {
+            return;
+        }
+
+        const uint64_t Epoch = m_Epoch;
+        if (t_Counts.m_Epoch != Epoch)
+        {
+            t_Counts = StressCallCounts{ .m_Epoch = Epoch };
+        }
+
+        const uint64_t CallCount = t_Counts.m_PerPoint[static_cast<size_t>(Point)]++;
+        const uint64_t Roll      = Mix(Seed ^ Mix(WorkerIndex) ^ Mix(static_cast<uint64_t>(Point) << 56 | CallCount));
+
+        // ~1/4 Yield, ~1/16 Sleep Long Enough To Let Another Thread Run Its Critical Section
+        switch (Roll & 0xF)
+        {
+        case 0:
+            std::this_thread::sleep_for(std::chrono::microseconds(Roll >> 4 & 0xFF));
+            break;
+        case 1: case 2: case 3: case 4:
+            std::this_thread::yield();
+            break;
+        default:
+            break;
+        }
+    }
+
+
+
+
+    /*
+        Record & Replay
+    */
+    inline
+    void ScheduleStress::BeginRecording(void) noexcept
+    {
+        m_Recording = true;
+        m_TaskOrder.clear();
+        NewEpoch();
+    }
+
+    [[nodiscard]] inline
+    std::vector<uint64_t> ScheduleStress::EndRecording(void) noexcept
+    {
+        m_Recording = false;
+        return std::move(m_TaskOrder);
+    }
+
+    inline
+    void ScheduleStress::BeginReplay(std::vector<uint64_t> TaskOrder) noexcept
+    {
+        m_Replaying    = true;
+        m_ReplayCursor = 0;
+        m_TaskOrder    = std::move(TaskOrder);
+        m_StartedOrder.clear();
+        NewEpoch();
+    }
+
+    [[nodiscard]] inline
+    std::vector<uint64_t> ScheduleStress::EndReplay(void) noexcept
+    {
+        m_Replaying = false;
+        m_TaskOrder.clear();
+        return std::move(m_StartedOrder);
+    }
+
+    [[nodiscard]] inline
+    bool ScheduleStress::IsReplaying(void) const noexcept
+    {
+        // Tasks Beyond The Recording Run Freely
+        return m_Replaying && m_ReplayCursor < m_TaskOrder.size();
+    }
+
+    [[nodiscard]] inline
+    bool ScheduleStress::CanStart(const uint64_t TaskID) const noexcept
+    {
+        return !IsReplaying() || m_TaskOrder[m_ReplayCursor] == TaskID;
+    }
+
+    inline
+    void ScheduleStress::OnTaskStarted(const uint64_t TaskID) noexcept
+    {
+        if (m_Recording)
+        {
+            m_TaskOrder.push_back(TaskID);
+        }
+        else if (m_Replaying)
+        {
+            m_StartedOrder.push_back(TaskID);
+            m_ReplayCursor += IsReplaying();
+        }
+    }
+
+    inline
+    void ScheduleStress::NewEpoch(void) noexcept
+    {
+        m_Epoch = NextEpoch();
+    }
+
+    [[nodiscard]] inline
+    uint64_t ScheduleStress::NextEpoch(void) noexcept
+    {
+        // Process Wide, So Counts Left Over From Another (Or A Destroyed) Pool Are Never Reused
+        static std::atomic_uint64_t Epoch = 0;
+        return ++Epoch;
+    }
+
+    [[nodiscard]] constexpr inline
+    uint64_t ScheduleStress::Mix(uint64_t Value) noexcept
+    {
+        // SplitMix64 Finalizer
+        Value += 0x9E3779B97F4A7C15ull;
+        Value  = (Value ^ (Value >> 30)) * 0xBF58476D1CE4E5B9ull;
+        Value  = (Value ^ (Value >> 27)) * 0x94D049BB133111EBull;
+        return Value ^ (Value >> 31);
+    }
+}
\ No newline at end of file
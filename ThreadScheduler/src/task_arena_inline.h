@@ -0,0 +1,147 @@
+#pragma once
+
+#include <mutex>
+#include <cassert>
+#include <algorithm>
+
+namespace jpd
+{
+    inline
+    TaskArena::TaskArena(ThreadPool& Pool, std::string_view Name, const size_t MaxConcurrency, const size_t Weight, const size_t ReservedConcurrency) noexcept :
+        m_Pool{ Pool }
+    ,   m_Name{ Name }
+    ,   m_MaxConcurrency{ MaxConcurrency }
+    ,   m_Weight{ std::max<size_t>(Weight, 1) }
+    ,   m_ReservedConcurrency{ std::min(ReservedConcurrency, MaxConcurrency) }
+    { }
+
+    template <typename Func, typename... T_Args, typename ReturnType>
+    [[nodiscard]] inline
+    std::future<ReturnType> TaskArena::QueueFunction(Func&& F, T_Args&&... Args) noexcept
+    {
+        // Arena Tasks Are Profiled Under The Arena's Name
+        return QueueFunction( TaskLabel{ m_Name.c_str() }
+                            , std::forward<Func>(F)
+                            , std::forward<T_Args>(Args)... );
+    }
+
+    template <typename Func, typename... T_Args, typename ReturnType>
+    [[nodiscard]] inline
+    std::future<ReturnType> TaskArena::QueueFunction(const TaskLabel& Label, Func&& F, T_Args&&... Args) noexcept
+    {
+        return m_Pool.QueueFunctionInto( this
+                                       , NoAffinity
+                                       , Label
+                                       , std::forward<Func>(F)
+                                       , std::forward<T_Args>(Args)... );
+    }
+
+    template <typename Func, typename... T_Args, typename ReturnType>
+    [[nodiscard]] inline
+    GroupTasks<ReturnType> TaskArena::QueueAndPartitionLoop(const size_t StartIndex, const size_t EndIndex, const size_t PartitionCount, const size_t MinPartitionSize, Func&& F, T_Args&&... Args) noexcept
+    {
+        return QueueAndPartitionLoop(TaskLabel{ m_Name.c_str() }, StartIndex, EndIndex, PartitionCount, MinPartitionSize, std::forward<Func>(F), std::forward<T_Args>(Args)...);
+    }
+
+    template <typename Func, typename... T_Args, typename ReturnType>
+    [[nodiscard]] inline
+    GroupTasks<ReturnType> TaskArena::QueueAndPartitionLoop(const TaskLabel& Label, const size_t StartIndex, const size_t EndIndex, const size_t PartitionCount, const size_t MinPartitionSize, Func&& F, T_Args&&... Args) noexcept
+    {
+        assert(PartitionCount > 0);
+
+        // Never Split Wider Than The Arena May Run At Once
+        auto StartIndices = m_Pool.PartitionLoopIndices( StartIndex, EndIndex, std::min(m_MaxConcurrency, m_Pool.ComputeThreadCount(PartitionCount)), MinPartitionSize ? MinPartitionSize : m_Pool.m_MinPartitionSize );
+        // Assign Relevant Number Of Partitions
+        GroupTasks<ReturnType> TaskFutures( StartIndices.size() - 1 );
+
+
+        for (size_t i = 0, max = StartIndices.size(); i < (max - 1); ++i)
+        {
+            TaskFutures[i] = QueueFunction( Label
+                                          , F
+                                          , StartIndices[i]
+                                          , StartIndices[i + 1]
+                                          , Args... );
+        }
+
+        return TaskFutures;
+    }
+
+    inline
+    void TaskArena::WaitForAllTasks(void) noexcept
+    {
+        // Before Locking - Sleeping With m_MutexLock Held Would Stall Every Worker
+        JPD_STRESS_POINT(m_Pool.m_Stress, StressPoint::Wait, m_Pool.GetWorkerIndex());
+
+        std::unique_lock<std::mutex> LockArena(m_Pool.m_MutexLock);
+        const bool   IsWorker = m_Pool.GetWorkerIndex() != NoAffinity;
+        // Tasks Further Up This Thread's Stack Cannot Finish Until This Wait Returns
+        const size_t OwnTasks = std::count(t_RunningArenas.begin(), t_RunningArenas.end(), this);
+
+        while (!m_TaskQueue.empty() || m_ActiveTasks > OwnTasks)
+        {
+            // A Worker Waiting Here Already Occupies A Thread - Run This Arena's Tasks Instead Of Idling,
+            // But Never Another Arena's, So Waits Stay Isolated (And Can't Deadlock Under m_MaxConcurrency)
+            // Own Tasks Are Suspended Below This Wait, So Only Other Running Tasks Count Against The Limit
+            if (IsWorker && m_ActiveTasks - OwnTasks < m_MaxConcurrency && m_Pool.IsTaskReady(m_TaskQueue))
+            {
+                VoidFunc Task = m_Pool.PopTask(m_TaskQueue);
+                ++m_ActiveTasks;
+
+                LockArena.unlock();
+                Execute(Task);
+                LockArena.lock();
+
+                m_Pool.CompleteTask(this);
+                continue;
+            }
+
+            m_CVTaskCompleted.wait(LockArena);
+        }
+    }
+
+    [[nodiscard]] inline
+    const std::string& TaskArena::GetName(void) const noexcept
+    {
+        return m_Name;
+    }
+
+    [[nodiscard]] inline
+    size_t TaskArena::GetMaxConcurrency(void) const noexcept
+    {
+        return m_MaxConcurrency;
+    }
+
+    [[nodiscard]] inline
+    size_t TaskArena::GetWeight(void) const noexcept
+    {
+        return m_Weight;
+    }
+
+    [[nodiscard]] inline
+    size_t TaskArena::GetReservedConcurrency(void) const noexcept
+    {
+        return m_ReservedConcurrency;
+    }
+
+    [[nodiscard]] inline
+    size_t TaskArena::GetTotalTaskCount(void) const noexcept
+    {
+        std::scoped_lock LockArena(m_Pool.m_MutexLock);
+        return m_TaskQueue.size() + m_ActiveTasks;
+    }
+
+    [[nodiscard]] inline
+    bool TaskArena::HasCapacity(void) const noexcept
+    {
+        return m_ActiveTasks < m_MaxConcurrency;
+    }
+
+    inline
+    void TaskArena::Execute(VoidFunc& Task) noexcept
+    {
+        t_RunningArenas.push_back(this);
+        Task();
+        t_RunningArenas.pop_back();
+    }
+}
\ No newline at end of file
@@ -0,0 +1,208 @@
+#pragma once
+
+#include <ctime>
+#include <chrono>
+#include <algorithm>
+
+namespace jpd
+{
+    /*
+        Task Label
+    */
+    constexpr TaskLabel::TaskLabel(const char* Name) noexcept :
+        m_Name{ Name }
+    ,   m_Hash{ Hash(Name) }
+    { }
+
+    constexpr TaskLabel::TaskLabel(const uint64_t Hash) noexcept :
+        m_Hash{ Hash ? Hash : 1 }
+    { }
+
+    [[nodiscard]] constexpr inline
+    uint64_t TaskLabel::Hash(const char* Name) noexcept
+    {
+        // FNV-1a
+        uint64_t Value = 0xCBF29CE484222325ull;
+        for (; Name && *Name; ++Name)
+        {
+            Value = (Value ^ static_cast<uint8_t>(*Name)) * 0x100000001B3ull;
+        }
+        return Value ? Value : 1;
+    }
+
+
+
+
+    /*
+        Task Profiler
+    */
+    inline
+    TaskProfiler::TaskProfiler(const size_t WorkerCount) noexcept :
+        m_WorkerCount{ WorkerCount }
+    ,   m_Tables{ std::make_unique<WorkerTable[]>(WorkerCount) }
+    { }
+
+    inline
+    void TaskProfiler::Enable(const bool Enabled) noexcept
+    {
+        m_Enabled.store(Enabled, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] inline
+    bool TaskProfiler::IsEnabled(void) const noexcept
+    {
+        return m_Enabled.load(std::memory_order_relaxed);
+    }
+
+    inline
+    void TaskProfiler::Reset(void) noexcept
+    {
+        for (size_t Worker = 0; Worker < m_WorkerCount; ++Worker)
+        {
+            for (auto& Entry : m_Tables[Worker])
+            {
+                Entry.m_Count.store(0, std::memory_order_relaxed);
+                Entry.m_WallNs.store(0, std::memory_order_relaxed);
+                Entry.m_CpuNs.store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    [[nodiscard]] inline
+    TaskProfiler::Sample TaskProfiler::Begin(const size_t WorkerIndex, const TaskLabel& Label) noexcept
+    {
+        if (!IsEnabled() || WorkerIndex >= m_WorkerCount)
+        {
+            return {};
+        }
+
+        constexpr TaskLabel Unlabeled{ "<unlabeled>" };
+        const TaskLabel& Key = Label.m_Hash ? Label : Unlabeled;
+
+        // Nested Inside Another Sample On This Thread - e.g. A Worker Helping In TaskArena::WaitForAllTasks
+        const uint64_t ParentPath = t_Frames.empty() ? 0 : t_Frames.back().m_Path;
+        const uint64_t Path       = ComputePath(ParentPath, Key.m_Hash);
+
+        // Claimed Up Front, So Nested Samples Recorded Before This One Ends Can Name Their Parent
+        const size_t SlotIndex = FindSlot(WorkerIndex, Path, ParentPath, Key);
+        t_Frames.push_back(Frame{ .m_Path = Path });
+
+        return Sample{ .m_Enabled     = true
+                     , .m_WorkerIndex = WorkerIndex
+                     , .m_SlotIndex   = SlotIndex
+                     , .m_WallNs      = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count())
+                     , .m_CpuNs       = GetThreadCPUTime() };
+    }
+
+    inline
+    void TaskProfiler::End(const Sample& Start) noexcept
+    {
+        if (!Start.m_Enabled)
+        {
+            return;
+        }
+
+        const uint64_t WallNs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count()) - Start.m_WallNs;
+        const uint64_t CpuNs  = GetThreadCPUTime() - Start.m_CpuNs;
+
+        // Charge The Enclosing Sample's Children With Our Inclusive Time, Keep Only Our Self Time
+        const Frame Self = t_Frames.back();
+        t_Frames.pop_back();
+        if (!t_Frames.empty())
+        {
+            t_Frames.back().m_ChildWallNs += WallNs;
+            t_Frames.back().m_ChildCpuNs  += CpuNs;
+        }
+
+        if (Start.m_SlotIndex >= TableSize)
+        {
+            return;
+        }
+
+        // Only This Worker Writes Its Table, So Plain Load/Store Is Enough
+        Slot& Entry = m_Tables[Start.m_WorkerIndex][Start.m_SlotIndex];
+        Entry.m_Count.store(Entry.m_Count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        Entry.m_WallNs.store(Entry.m_WallNs.load(std::memory_order_relaxed) + WallNs - std::min(Self.m_ChildWallNs, WallNs), std::memory_order_relaxed);
+        Entry.m_CpuNs.store(Entry.m_CpuNs.load(std::memory_order_relaxed) + CpuNs - std::min(Self.m_ChildCpuNs, CpuNs), std::memory_order_relaxed);
+    }
+
+    template <typename Func>
+    inline
+    void TaskProfiler::ForEachEntry(Func&& F) const noexcept
+    {
+        for (size_t Worker = 0; Worker < m_WorkerCount; ++Worker)
+        {
+            for (const auto& Entry : m_Tables[Worker])
+            {
+                const uint64_t Hash = Entry.m_Hash.load(std::memory_order_acquire);
+                if (Hash == 0)
+                {
+                    continue;
+                }
+
+                TaskProfileEntry Counters{ .m_Label      = TaskLabel{ Entry.m_Label.load(std::memory_order_relaxed) }
+                                         , .m_Path       = Hash
+                                         , .m_ParentPath = Entry.m_Parent.load(std::memory_order_relaxed)
+                                         , .m_Count      = Entry.m_Count.load(std::memory_order_relaxed)
+                                         , .m_WallNs     = Entry.m_WallNs.load(std::memory_order_relaxed)
+                                         , .m_CpuNs      = Entry.m_CpuNs.load(std::memory_order_relaxed) };
+                Counters.m_Label.m_Name = Entry.m_Name.load(std::memory_order_relaxed);
+
+                F(Worker, Counters);
+            }
+        }
+    }
+
+    [[nodiscard]] constexpr inline
+    uint64_t TaskProfiler::ComputePath(const uint64_t ParentPath, const uint64_t LabelHash) noexcept
+    {
+        // FNV-1a Over Both Hashes - Order Matters, So "A;B" & "B;A" Differ
+        uint64_t Value = 0xCBF29CE484222325ull;
+        Value = (Value ^ ParentPath) * 0x100000001B3ull;
+        Value = (Value ^ LabelHash)  * 0x100000001B3ull;
+        return Value ? Value : 1;
+    }
+
+    [[nodiscard]] inline
+    size_t TaskProfiler::FindSlot(const size_t WorkerIndex, const uint64_t Path, const uint64_t ParentPath, const TaskLabel& Label) noexcept
+    {
+        // Linear Probing - Only This Worker Inserts Into Its Table, So Plain Load/Store Is Enough
+        auto& Table = m_Tables[WorkerIndex];
+
+        for (size_t Probe = 0; Probe < TableSize; ++Probe)
+        {
+            const size_t   Index    = (Path + Probe) & (TableSize - 1);
+            Slot&          Entry    = Table[Index];
+            const uint64_t SlotHash = Entry.m_Hash.load(std::memory_order_relaxed);
+
+            if (SlotHash == Path)
+            {
+                return Index;
+            }
+
+            if (SlotHash == 0)
+            {
+                Entry.m_Label.store(Label.m_Hash, std::memory_order_relaxed);
+                Entry.m_Parent.store(ParentPath, std::memory_order_relaxed);
+                Entry.m_Name.store(Label.m_Name, std::memory_order_relaxed);
+                Entry.m_Hash.store(Path, std::memory_order_release);
+                return Index;
+            }
+        }
+
+        // Table Full - Sample Dropped
+        return TableSize;
+    }
+
+    [[nodiscard]] inline
+    uint64_t TaskProfiler::GetThreadCPUTime(void) noexcept
+    {
+#if defined(__linux__) || defined(__APPLE__)
+        timespec Time;
+        clock_gettime(CLOCK_THREAD_CPUTIME_ID, &Time);
+        return static_cast<uint64_t>(Time.tv_sec) * 1'000'000'000ull + static_cast<uint64_t>(Time.tv_nsec);
+#else
+        return 0;
+#endif
+    }
+}
\ No newline at end of file
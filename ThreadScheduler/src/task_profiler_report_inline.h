@@ -0,0 +1,121 @@
+#pragma once
+
+#include <cstdio>
+#include <utility>
+#include <algorithm>
+#include <unordered_map>
+
+namespace jpd
+{
+    [[nodiscard]] inline
+    std::vector<TaskProfileEntry> SnapshotProfile(const TaskProfiler& Profiler) noexcept
+    {
+        std::unordered_map<uint64_t, TaskProfileEntry> Totals;
+
+        Profiler.ForEachEntry([&Totals](size_t, const TaskProfileEntry& Entry)
+                              {
+                                  auto& Total = Totals[Entry.m_Label.m_Hash];
+                                  Total.m_Label   = Entry.m_Label;
+                                  Total.m_Count  += Entry.m_Count;
+                                  Total.m_WallNs += Entry.m_WallNs;
+                                  Total.m_CpuNs  += Entry.m_CpuNs;
+                              });
+
+        std::vector<TaskProfileEntry> Entries;
+        Entries.reserve(Totals.size());
+        for (auto& [Hash, Total] : Totals)
+        {
+            // Claimed By A Task That Is Still Running
+            if (Total.m_Count)
+            {
+                Entries.push_back(Total);
+            }
+        }
+
+        std::sort(Entries.begin(), Entries.end(), [](const TaskProfileEntry& A, const TaskProfileEntry& B)
+                                                  {
+                                                      return A.m_CpuNs != B.m_CpuNs ? A.m_CpuNs  > B.m_CpuNs
+                                                                                    : A.m_WallNs > B.m_WallNs;
+                                                  });
+        return Entries;
+    }
+
+    inline
+    void PrintTopN(const TaskProfiler& Profiler, std::ostream& Out, const size_t Count) noexcept
+    {
+        const auto Entries = SnapshotProfile(Profiler);
+
+        Out << "Label                            Count      Wall (ms)      CPU (ms)   Avg Wall (us)\n";
+        for (size_t i = 0, max = std::min(Count, Entries.size()); i < max; ++i)
+        {
+            const auto& Entry = Entries[i];
+            char Line[160];
+            std::snprintf( Line, sizeof(Line), "%-28.28s %9llu %14.3f %13.3f %15.3f\n"
+                         , GetLabelName(Entry.m_Label).c_str()
+                         , static_cast<unsigned long long>(Entry.m_Count)
+                         , Entry.m_WallNs / 1e6
+                         , Entry.m_CpuNs / 1e6
+                         , Entry.m_Count ? Entry.m_WallNs / 1e3 / Entry.m_Count : 0.0 );
+            Out << Line;
+        }
+    }
+
+    inline
+    void PrintFoldedStacks(const TaskProfiler& Profiler, std::ostream& Out) noexcept
+    {
+        std::vector<std::pair<size_t, TaskProfileEntry>> Entries;
+        Profiler.ForEachEntry([&Entries](const size_t Worker, const TaskProfileEntry& Entry)
+                              {
+                                  Entries.emplace_back(Worker, Entry);
+                              });
+
+        // Paths Are Per Worker - A Nested Task's Parent Was Claimed On The Same Worker
+        std::unordered_map<uint64_t, const TaskProfileEntry*> Paths;
+        for (size_t i = 0; i < Entries.size(); )
+        {
+            const size_t Worker = Entries[i].first;
+            Paths.clear();
+            for (size_t j = i; j < Entries.size() && Entries[j].first == Worker; ++j)
+            {
+                Paths[Entries[j].second.m_Path] = &Entries[j].second;
+            }
+
+            for (; i < Entries.size() && Entries[i].first == Worker; ++i)
+            {
+                const auto& Entry = Entries[i].second;
+                if (Entry.m_Count == 0)
+                {
+                    continue;
+                }
+
+                // Outermost Label First - Bounded In Case Of A Path Hash Collision
+                std::string Stack = GetLabelName(Entry.m_Label);
+                auto Parent = Paths.find(Entry.m_ParentPath);
+                for (size_t Depth = 0; Parent != Paths.end() && Depth < 64; ++Depth)
+                {
+                    Stack  = GetLabelName(Parent->second->m_Label) + ";" + Stack;
+                    Parent = Paths.find(Parent->second->m_ParentPath);
+                }
+
+                // Self Time, So flamegraph.pl Sums Nested Frames Into Their Parents Exactly Once
+                // Fall Back To Wall Time Where Thread CPU Time Is Unavailable
+                const uint64_t Ns = Entry.m_CpuNs ? Entry.m_CpuNs : Entry.m_WallNs;
+
+                Out << "Worker " << Worker << ";" << Stack << " " << Ns / 1000 << "\n";
+            }
+        }
+    }
+
+    [[nodiscard]] inline
+    std::string GetLabelName(const TaskLabel& Label) noexcept
+    {
+        if (Label.m_Name)
+        {
+            return Label.m_Name;
+        }
+
+        char Name[24];
+        std::snprintf(Name, sizeof(Name), "0x%016llx", static_cast<unsigned long long>(Label.m_Hash));
+        return Name;
+    }
+}
\ No newline at end of file
@@ -1,64 +1,213 @@
 #pragma once
 
+#include <cstdio>
+#include <cassert>
+#include <utility>
+#include <algorithm>
+#include <exception>
+
 namespace jpd
 {
     /*
         Public Member Functions
     */
+    inline
     ThreadPool::ThreadPool(const size_t ThreadCount, const size_t MinimumPartitionSize) noexcept :
         m_AvailableThreads{ ComputeThreadCount(ThreadCount) }
     ,   m_MinPartitionSize{ MinimumPartitionSize }
+    ,   m_Profiler{ ComputeThreadCount(0) }
     {
         CreateThreads();
     }
 
+    inline
     ThreadPool::~ThreadPool() noexcept
     {
+#if defined(__linux__)
+        // Cancels Outstanding I/O - Their Completions Still Need Worker Threads
+        m_IOReactor.reset();
+#endif
         WaitForAllTasks();
         DestroyThreads();
     }
 
-    inline [[nodiscard]]
+    [[nodiscard]] inline
+    ThreadPool& ThreadPool::GetGlobal(void) noexcept
+    {
+        static ThreadPool GlobalPool{};
+        return GlobalPool;
+    }
+
+    [[nodiscard]] inline
+    TaskArena& ThreadPool::CreateArena(std::string_view Name, const size_t MaxConcurrency, const size_t Weight, const size_t ReservedConcurrency) noexcept
+    {
+        // Lookup & Insert Under One Lock - Two Threads Creating The Same Name Share One Arena
+        std::scoped_lock LockArenas(m_MutexLock);
+        if (auto* Existing = FindArenaUnlocked(Name))
+        {
+            return *Existing;
+        }
+        return m_Arenas.emplace_back(*this, Name, ComputeThreadCount(MaxConcurrency), Weight, ReservedConcurrency);
+    }
+
+    [[nodiscard]] inline
+    TaskArena* ThreadPool::FindArena(std::string_view Name) noexcept
+    {
+        std::scoped_lock LockArenas(m_MutexLock);
+        return FindArenaUnlocked(Name);
+    }
+
+#if defined(JPD_SCHEDULER_STRESS)
+    inline
+    void ThreadPool::SeedStress(const uint64_t Seed) noexcept
+    {
+        m_Stress.Seed(Seed);
+    }
+
+    inline
+    void ThreadPool::BeginRecording(void) noexcept
+    {
+        BEGIN_SCOPE_LOCK(m_MutexLock);
+            m_NextTaskID = 0;
+            m_Stress.BeginRecording();
+        END_SCOPE_LOCK()
+    }
+
+    [[nodiscard]] inline
+    std::vector<uint64_t> ThreadPool::EndRecording(void) noexcept
+    {
+        std::scoped_lock LockRecording(m_MutexLock);
+        return m_Stress.EndRecording();
+    }
+
+    inline
+    void ThreadPool::BeginReplay(std::vector<uint64_t> TaskOrder) noexcept
+    {
+        BEGIN_SCOPE_LOCK(m_MutexLock);
+            m_NextTaskID = 0;
+            m_Stress.BeginReplay(std::move(TaskOrder));
+        END_SCOPE_LOCK()
+    }
+
+    [[nodiscard]] inline
+    std::vector<uint64_t> ThreadPool::EndReplay(void) noexcept
+    {
+        std::vector<uint64_t> StartedOrder;
+        BEGIN_SCOPE_LOCK(m_MutexLock);
+            StartedOrder = m_Stress.EndReplay();
+        END_SCOPE_LOCK()
+        m_CVNewTask.notify_all();
+        return StartedOrder;
+    }
+#endif
+
+    [[nodiscard]] inline
     size_t ThreadPool::GetTotalTaskCount(void) const noexcept
     {
-        return m_TaskQueue.size();
+        std::scoped_lock LockQueues(m_MutexLock);
+        return GetQueuedTaskCount();
     }
 
-    inline [[nodiscard]]
+    [[nodiscard]] inline
     size_t ThreadPool::GetActiveTaskCount(void) const noexcept
     {
-        return m_TotalTaskCount - m_TaskQueue.size();
+        std::scoped_lock LockQueues(m_MutexLock);
+        return m_TotalTaskCount - GetQueuedTaskCount();
+    }
+
+    [[nodiscard]] inline
+    size_t ThreadPool::GetWorkerIndex(void) const noexcept
+    {
+        return t_CurrentPool == this ? t_WorkerIndex
+                                     : NoAffinity;
+    }
+
+    [[nodiscard]] inline
+    TaskProfiler& ThreadPool::GetProfiler(void) noexcept
+    {
+        return m_Profiler;
     }
 
     template <typename Func, typename... T_Args, typename ReturnType>
-    inline [[nodiscard]]
+    [[nodiscard]] inline
     std::future<ReturnType> ThreadPool::QueueFunction(Func&& F, T_Args&&... Args) noexcept
+    {
+        return QueueFunctionOnWorker( NoAffinity
+                                    , std::forward<Func>(F)
+                                    , std::forward<T_Args>(Args)... );
+    }
+
+    template <typename Func, typename... T_Args, typename ReturnType>
+    [[nodiscard]] inline
+    std::future<ReturnType> ThreadPool::QueueFunction(const TaskLabel& Label, Func&& F, T_Args&&... Args) noexcept
+    {
+        return QueueFunctionInto( nullptr
+                                , NoAffinity
+                                , Label
+                                , std::forward<Func>(F)
+                                , std::forward<T_Args>(Args)... );
+    }
+
+    template <typename Func, typename... T_Args, typename ReturnType>
+    [[nodiscard]] inline
+    std::future<ReturnType> ThreadPool::QueueFunctionOnWorker(const size_t WorkerIndex, Func&& F, T_Args&&... Args) noexcept
+    {
+        return QueueFunctionOnWorker( TaskLabel{}
+                                    , WorkerIndex
+                                    , std::forward<Func>(F)
+                                    , std::forward<T_Args>(Args)... );
+    }
+
+    template <typename Func, typename... T_Args, typename ReturnType>
+    [[nodiscard]] inline
+    std::future<ReturnType> ThreadPool::QueueFunctionOnWorker(const TaskLabel& Label, const size_t WorkerIndex, Func&& F, T_Args&&... Args) noexcept
+    {
+        return QueueFunctionInto( nullptr
+                                , WorkerIndex
+                                , Label
+                                , std::forward<Func>(F)
+                                , std::forward<T_Args>(Args)... );
+    }
+
+    template <typename Func, typename... T_Args, typename ReturnType>
+    [[nodiscard]] inline
+    std::future<ReturnType> ThreadPool::QueueFunctionInto(TaskArena* Arena, const size_t WorkerIndex, const TaskLabel& Label, Func&& F, T_Args&&... Args) noexcept
     {
         std::function<ReturnType()> Task = std::bind( std::forward<Func>(F)
                                                     , std::forward<T_Args>(Args)... );
         auto TaskPromise = std::make_shared<std::promise<ReturnType>>();
 
-        QueueTask( [Task, TaskPromise]()
+        QueueTask( Arena
+                 , WorkerIndex
+                 , [this, Label, Task, TaskPromise]()
                    {
+                       // Recorded Before The Promise Is Fulfilled So Waiters See The Sample
+                       const auto Sample = m_Profiler.Begin(GetWorkerIndex(), Label);
+
                        try
                        {
                            if constexpr (std::is_same_v<ReturnType, void>)
                            {
                                std::invoke(Task);
+                               m_Profiler.End(Sample);
                                TaskPromise->set_value();
                            }
                            else
                            {
-                               TaskPromise->set_value(std::invoke(Task));
+                               ReturnType Result = std::invoke(Task);
+                               m_Profiler.End(Sample);
+                               TaskPromise->set_value(std::forward<ReturnType>(Result));
                            }
                        }
                        catch (std::exception& e)
                        {
-                           std::cout << "Exception Occurred (QueueTask): " << e.what() << std::endl;
+                           m_Profiler.End(Sample);
+                           std::printf("Exception Occurred (QueueTask): %s\n", e.what());
                            TaskPromise->set_exception(std::current_exception());
                        }
                        catch (...)
                        {
+                           m_Profiler.End(Sample);
                            TaskPromise->set_exception(std::current_exception());
                        }
                    });
@@ -67,20 +216,29 @@ namespace jpd
     }
 
     template <typename Func, typename... Args, typename ReturnType>
-    inline [[nodiscard]]
+    [[nodiscard]] inline
     GroupTasks<ReturnType> ThreadPool::QueueAndPartitionLoop(const size_t EndIndex, const size_t PartitionCount, const size_t MinPartitionSize, Func&& F, Args&&... args) noexcept
     {
         assert(PartitionCount > 0);
 
-        return QueueAndPartitionLoop(0, EndIndex, PartitionCount, std::forward<Func>(F), std::forward<Args>(args)...);
+        return QueueAndPartitionLoop(0, EndIndex, PartitionCount, MinPartitionSize, std::forward<Func>(F), std::forward<Args>(args)...);
     }
 
     template <typename Func, typename... T_Args, typename ReturnType>
-    inline [[nodiscard]]
+    [[nodiscard]] inline
     GroupTasks<ReturnType> ThreadPool::QueueAndPartitionLoop(const size_t StartIndex, const size_t EndIndex, const size_t PartitionCount, const size_t MinPartitionSize, Func&& F, T_Args&&... Args) noexcept
     {
         assert(PartitionCount > 0);
 
+        return QueueAndPartitionLoop(TaskLabel{}, StartIndex, EndIndex, PartitionCount, MinPartitionSize, std::forward<Func>(F), std::forward<T_Args>(Args)...);
+    }
+
+    template <typename Func, typename... T_Args, typename ReturnType>
+    [[nodiscard]] inline
+    GroupTasks<ReturnType> ThreadPool::QueueAndPartitionLoop(const TaskLabel& Label, const size_t StartIndex, const size_t EndIndex, const size_t PartitionCount, const size_t MinPartitionSize, Func&& F, T_Args&&... Args) noexcept
+    {
+        assert(PartitionCount > 0);
+
         auto StartIndices = PartitionLoopIndices( StartIndex, EndIndex, ComputeThreadCount(PartitionCount), MinPartitionSize ? MinPartitionSize : m_MinPartitionSize);
         // Assign Relevant Number Of Partitions
         GroupTasks<ReturnType> TaskFutures( StartIndices.size() - 1 );
@@ -88,10 +246,172 @@ namespace jpd
 
         for (size_t i = 0, max = StartIndices.size(); i < (max - 1); ++i)
         {
-            TaskFutures[i] = QueueFunction( std::forward<Func>(F)
+            TaskFutures[i] = QueueFunction( Label
+                                          , F
                                           , StartIndices[i]
                                           , StartIndices[i + 1]
-                                          , std::forward<T_Args>(Args)... );
+                                          , Args... );
+        }
+
+        return TaskFutures;
+    }
+
+    template <typename Func, typename... T_Args, typename ReturnType>
+    [[nodiscard]] inline
+    GroupTasks<ReturnType> ThreadPool::QueueAndPartitionAlignedLoop(const size_t StartIndex, const size_t EndIndex, const size_t PartitionCount, const size_t MinPartitionSize, const PartitionAlignment Alignment, Func&& F, T_Args&&... Args) noexcept
+    {
+        return QueueAndPartitionAlignedLoop(TaskLabel{}, StartIndex, EndIndex, PartitionCount, MinPartitionSize, Alignment, std::forward<Func>(F), std::forward<T_Args>(Args)...);
+    }
+
+    template <typename Func, typename... T_Args, typename ReturnType>
+    [[nodiscard]] inline
+    GroupTasks<ReturnType> ThreadPool::QueueAndPartitionAlignedLoop(const TaskLabel& Label, const size_t StartIndex, const size_t EndIndex, const size_t PartitionCount, const size_t MinPartitionSize, const PartitionAlignment Alignment, Func&& F, T_Args&&... Args) noexcept
+    {
+        assert(PartitionCount > 0);
+
+        auto StartIndices = PartitionAlignedLoopIndices( StartIndex, EndIndex, ComputeThreadCount(PartitionCount), MinPartitionSize ? MinPartitionSize : m_MinPartitionSize, Alignment );
+        // Assign Relevant Number Of Partitions
+        GroupTasks<ReturnType> TaskFutures( StartIndices.size() - 1 );
+
+
+        for (size_t i = 0, max = StartIndices.size(); i < (max - 1); ++i)
+        {
+            TaskFutures[i] = QueueFunction( Label
+                                          , F
+                                          , StartIndices[i]
+                                          , StartIndices[i + 1]
+                                          , Args... );
+        }
+
+        return TaskFutures;
+    }
+
+    template <typename Func, typename... T_Args, typename ReturnType>
+    [[nodiscard]] inline
+    GroupTasks<ReturnType> ThreadPool::QueueAndPartitionLoop(const BlockedRange2D& Range, const size_t PartitionCount, const PartitionAlignment Alignment, Func&& F, T_Args&&... Args) noexcept
+    {
+        return QueueAndPartitionLoop(TaskLabel{}, Range, PartitionCount, Alignment, std::forward<Func>(F), std::forward<T_Args>(Args)...);
+    }
+
+    template <typename Func, typename... T_Args, typename ReturnType>
+    [[nodiscard]] inline
+    GroupTasks<ReturnType> ThreadPool::QueueAndPartitionLoop(const TaskLabel& Label, const BlockedRange2D& Range, const size_t PartitionCount, const PartitionAlignment Alignment, Func&& F, T_Args&&... Args) noexcept
+    {
+        assert(PartitionCount > 0);
+
+        // Cols Are Contiguous - Only Their Boundaries Need To Land On Aligned Elements
+        const size_t ColGranularity = Alignment.GetGranularity();
+        const size_t ColGrainSize   = RoundUpToMultiple(std::max<size_t>(Range.m_Cols.m_GrainSize, 1), ColGranularity);
+
+        const auto TileCounts = ComputeTileCounts<2>( { Range.m_Rows.Size(), Range.m_Cols.Size() }
+                                                    , { Range.m_Rows.m_GrainSize, ColGrainSize }
+                                                    , ComputeThreadCount(PartitionCount) );
+
+        const auto RowIndices = PartitionRange( Range.m_Rows.m_Begin, std::max(Range.m_Rows.m_Begin, Range.m_Rows.m_End), TileCounts[0], Range.m_Rows.m_GrainSize );
+        const auto ColIndices = PartitionRange( Range.m_Cols.m_Begin, std::max(Range.m_Cols.m_Begin, Range.m_Cols.m_End), TileCounts[1], ColGrainSize, ColGranularity, Alignment.m_AlignedIndex );
+        // Assign Relevant Number Of Tiles
+        GroupTasks<ReturnType> TaskFutures( (RowIndices.size() - 1) * (ColIndices.size() - 1) );
+
+
+        for (size_t Row = 0, Task = 0; Row < RowIndices.size() - 1; ++Row)
+        {
+            for (size_t Col = 0; Col < ColIndices.size() - 1; ++Col, ++Task)
+            {
+                const BlockedRange2D Tile{ .m_Rows = { RowIndices[Row], RowIndices[Row + 1], Range.m_Rows.m_GrainSize }
+                                         , .m_Cols = { ColIndices[Col], ColIndices[Col + 1], Range.m_Cols.m_GrainSize } };
+
+                TaskFutures[Task] = QueueFunction( Label
+                                                 , F
+                                                 , Tile
+                                                 , Args... );
+            }
+        }
+
+        return TaskFutures;
+    }
+
+    template <typename Func, typename... T_Args, typename ReturnType>
+    [[nodiscard]] inline
+    GroupTasks<ReturnType> ThreadPool::QueueAndPartitionLoop(const BlockedRange3D& Range, const size_t PartitionCount, const PartitionAlignment Alignment, Func&& F, T_Args&&... Args) noexcept
+    {
+        return QueueAndPartitionLoop(TaskLabel{}, Range, PartitionCount, Alignment, std::forward<Func>(F), std::forward<T_Args>(Args)...);
+    }
+
+    template <typename Func, typename... T_Args, typename ReturnType>
+    [[nodiscard]] inline
+    GroupTasks<ReturnType> ThreadPool::QueueAndPartitionLoop(const TaskLabel& Label, const BlockedRange3D& Range, const size_t PartitionCount, const PartitionAlignment Alignment, Func&& F, T_Args&&... Args) noexcept
+    {
+        assert(PartitionCount > 0);
+
+        // Cols Are Contiguous - Only Their Boundaries Need To Land On Aligned Elements
+        const size_t ColGranularity = Alignment.GetGranularity();
+        const size_t ColGrainSize   = RoundUpToMultiple(std::max<size_t>(Range.m_Cols.m_GrainSize, 1), ColGranularity);
+
+        const auto TileCounts = ComputeTileCounts<3>( { Range.m_Pages.Size(), Range.m_Rows.Size(), Range.m_Cols.Size() }
+                                                    , { Range.m_Pages.m_GrainSize, Range.m_Rows.m_GrainSize, ColGrainSize }
+                                                    , ComputeThreadCount(PartitionCount) );
+
+        const auto PageIndices = PartitionRange( Range.m_Pages.m_Begin, std::max(Range.m_Pages.m_Begin, Range.m_Pages.m_End), TileCounts[0], Range.m_Pages.m_GrainSize );
+        const auto RowIndices  = PartitionRange( Range.m_Rows.m_Begin,  std::max(Range.m_Rows.m_Begin,  Range.m_Rows.m_End),  TileCounts[1], Range.m_Rows.m_GrainSize );
+        const auto ColIndices  = PartitionRange( Range.m_Cols.m_Begin,  std::max(Range.m_Cols.m_Begin,  Range.m_Cols.m_End),  TileCounts[2], ColGrainSize, ColGranularity, Alignment.m_AlignedIndex );
+        // Assign Relevant Number Of Tiles
+        GroupTasks<ReturnType> TaskFutures( (PageIndices.size() - 1) * (RowIndices.size() - 1) * (ColIndices.size() - 1) );
+
+
+        for (size_t Page = 0, Task = 0; Page < PageIndices.size() - 1; ++Page)
+        {
+            for (size_t Row = 0; Row < RowIndices.size() - 1; ++Row)
+            {
+                for (size_t Col = 0; Col < ColIndices.size() - 1; ++Col, ++Task)
+                {
+                    const BlockedRange3D Tile{ .m_Pages = { PageIndices[Page], PageIndices[Page + 1], Range.m_Pages.m_GrainSize }
+                                             , .m_Rows  = { RowIndices[Row],   RowIndices[Row + 1],   Range.m_Rows.m_GrainSize }
+                                             , .m_Cols  = { ColIndices[Col],   ColIndices[Col + 1],   Range.m_Cols.m_GrainSize } };
+
+                    TaskFutures[Task] = QueueFunction( Label
+                                                     , F
+                                                     , Tile
+                                                     , Args... );
+                }
+            }
+        }
+
+        return TaskFutures;
+    }
+
+    template <typename Func, typename... T_Args, typename ReturnType>
+    [[nodiscard]] inline
+    GroupTasks<ReturnType> ThreadPool::QueueAndPartitionLoop(const size_t StartIndex, const size_t EndIndex, const size_t PartitionCount, const size_t MinPartitionSize, AffinityPartitioner& Partitioner, Func&& F, T_Args&&... Args) noexcept
+    {
+        return QueueAndPartitionLoop(TaskLabel{}, StartIndex, EndIndex, PartitionCount, MinPartitionSize, Partitioner, std::forward<Func>(F), std::forward<T_Args>(Args)...);
+    }
+
+    template <typename Func, typename... T_Args, typename ReturnType>
+    [[nodiscard]] inline
+    GroupTasks<ReturnType> ThreadPool::QueueAndPartitionLoop(const TaskLabel& Label, const size_t StartIndex, const size_t EndIndex, const size_t PartitionCount, const size_t MinPartitionSize, AffinityPartitioner& Partitioner, Func&& F, T_Args&&... Args) noexcept
+    {
+        assert(PartitionCount > 0);
+
+        auto StartIndices = PartitionLoopIndices( StartIndex, EndIndex, ComputeThreadCount(PartitionCount), MinPartitionSize ? MinPartitionSize : m_MinPartitionSize);
+        // Reuse The Previous Chunk -> Worker Mapping If The Loop Is Partitioned Identically
+        Partitioner.Prepare( StartIndices, m_AvailableThreads );
+        // Assign Relevant Number Of Partitions
+        GroupTasks<ReturnType> TaskFutures( StartIndices.size() - 1 );
+
+
+        for (size_t i = 0, max = StartIndices.size(); i < (max - 1); ++i)
+        {
+            TaskFutures[i] = QueueFunctionOnWorker( Label
+                                                  , Partitioner.GetWorker(i)
+                                                  , [this, &Partitioner, i, F](const size_t Begin, const size_t End, auto&&... BoundArgs) -> ReturnType
+                                                    {
+                                                        // Remember Where This Chunk Actually Ran For The Next Pass
+                                                        Partitioner.RecordWorker(i, GetWorkerIndex());
+                                                        return std::invoke(F, Begin, End, BoundArgs...);
+                                                    }
+                                                  , StartIndices[i]
+                                                  , StartIndices[i + 1]
+                                                  , Args... );
         }
 
         return TaskFutures;
@@ -100,13 +420,15 @@ namespace jpd
     inline
     void ThreadPool::WaitForAllTasks(void) noexcept
     {
-        m_Waiting = true;
+        JPD_STRESS_POINT(m_Stress, StressPoint::Wait, GetWorkerIndex());
+
+        ++m_Waiting;
         std::unique_lock<std::mutex> LockThreads(m_MutexLock);
         m_CVTaskCompleted.wait(LockThreads, [this]
                                             {
-                                                return m_TotalTaskCount == (m_Paused ? m_TaskQueue.size() : 0);
+                                                return m_TotalTaskCount == (m_Paused ? GetQueuedTaskCount() : 0);
                                             });
-        m_Waiting = false;
+        --m_Waiting;
     }
 
     inline
@@ -132,10 +454,12 @@ namespace jpd
     {
         m_Running = true;
         m_Threads = std::make_unique<std::thread[]>(m_AvailableThreads);
+        m_WorkerQueues = std::make_unique<TaskQueue[]>(m_AvailableThreads);
+        m_WorkerBusy   = std::make_unique<bool[]>(m_AvailableThreads);
 
         for (size_t i = 0; i < m_AvailableThreads; ++i)
         {
-            m_Threads[i] = std::thread(&ThreadPool::WorkerThread, this);
+            m_Threads[i] = std::thread(&ThreadPool::WorkerThread, this, i);
         }
     }
 
@@ -149,24 +473,62 @@ namespace jpd
         {
             m_Threads[i].join();
         }
+
+        // Pinned Tasks Lose Their Affinity - The Worker Count May Change Before They Run
+        BEGIN_SCOPE_LOCK(m_MutexLock);
+            for (size_t i = 0; i < m_AvailableThreads; ++i)
+            {
+                for (; !m_WorkerQueues[i].empty(); m_WorkerQueues[i].pop())
+                {
+                    m_TaskQueue.push(std::move(m_WorkerQueues[i].front()));
+                }
+            }
+        END_SCOPE_LOCK()
     }
 
     template <typename Func, typename... T_Args, typename ReturnType>
     inline
-    void ThreadPool::QueueTask(Func&& F, T_Args&&... Args) noexcept
+    void ThreadPool::QueueTask(TaskArena* Arena, const size_t WorkerIndex, Func&& F, T_Args&&... Args) noexcept
     {
         VoidFunc Task = std::bind( std::forward<Func>(F)
                                  , std::forward<T_Args>(Args)... );
 
+        JPD_STRESS_POINT(m_Stress, StressPoint::QueuePush, GetWorkerIndex());
+
         BEGIN_SCOPE_LOCK(m_MutexLock);
-            m_TaskQueue.push(Task);
+            ScheduledTask Scheduled{ std::move(Task), m_NextTaskID++ };
+
+            if (Arena)
+            {
+                Arena->m_TaskQueue.push(std::move(Scheduled));
+                // Wakes Workers Helping In Arena->WaitForAllTasks
+                Arena->m_CVTaskCompleted.notify_all();
+            }
+            else if (WorkerIndex == NoAffinity)
+            {
+                m_TaskQueue.push(std::move(Scheduled));
+            }
+            else
+            {
+                m_WorkerQueues[WorkerIndex % m_AvailableThreads].push(std::move(Scheduled));
+            }
+
+            // Counted With The Push - A Worker May Pop & Complete The Task As Soon As The Lock Drops
+            ++m_TotalTaskCount;
         END_SCOPE_LOCK()
 
-        ++m_TotalTaskCount;
-        m_CVNewTask.notify_one();
+        // Pinned Tasks Must Wake Their Owner, Not Just Any Worker
+        if (WorkerIndex == NoAffinity)
+        {
+            m_CVNewTask.notify_one();
+        }
+        else
+        {
+            m_CVNewTask.notify_all();
+        }
     }
 
-    inline [[nodiscard]]
+    [[nodiscard]] inline
     size_t ThreadPool::ComputeThreadCount(const size_t ThreadCount) noexcept
     {
         return ThreadCount == 0 || ThreadCount > std::thread::hardware_concurrency() ? std::thread::hardware_concurrency()
@@ -174,30 +536,217 @@ namespace jpd
     }
 
     inline
-    void ThreadPool::WorkerThread(void) noexcept
+    void ThreadPool::WorkerThread(const size_t WorkerIndex) noexcept
     {
+        t_CurrentPool = this;
+        t_WorkerIndex = WorkerIndex;
+
         while (m_Running)
         {
             VoidFunc Task;
             std::unique_lock<std::mutex> LockTask(m_MutexLock);
-            m_CVNewTask.wait(LockTask, [this]{ return (!m_TaskQueue.empty() || !m_Running); });
+            TaskArena* Arena = nullptr;
+            m_CVNewTask.wait(LockTask, [this, WorkerIndex, &Arena]{ return (FindTaskQueue(WorkerIndex, Arena) || !m_Running); });
 
             if (m_Running && !m_Paused)
             {
-                Task = m_TaskQueue.front();
-                m_TaskQueue.pop();
+                auto& Queue = *FindTaskQueue(WorkerIndex, Arena);
+                const bool Shared = (&Queue == &m_TaskQueue);
 
-                LockTask.unlock();
-                Task();
-                LockTask.lock();
+                Task = PopTask(Queue);
+                m_WorkerBusy[WorkerIndex] = true;
+                m_SharedActiveTasks += Shared;
+                if (Arena)
+                {
+                    ++Arena->m_ActiveTasks;
+                }
 
-                --m_TotalTaskCount;
-                if (m_Waiting)
+                // Remaining Pinned Tasks May Now Be Stolen By Idle Workers
+                if (!m_WorkerQueues[WorkerIndex].empty())
                 {
-                    m_CVTaskCompleted.notify_one();
+                    m_CVNewTask.notify_all();
                 }
+
+                LockTask.unlock();
+                JPD_STRESS_POINT(m_Stress, StressPoint::QueuePop, WorkerIndex);
+                if (Arena)
+                {
+                    Arena->Execute(Task);
+                }
+                else
+                {
+                    Task();
+                }
+                LockTask.lock();
+
+                m_WorkerBusy[WorkerIndex] = false;
+                m_SharedActiveTasks -= Shared;
+                CompleteTask(Arena);
+            }
+        }
+    }
+
+    [[nodiscard]] inline
+    ThreadPool::TaskQueue* ThreadPool::FindTaskQueue(const size_t WorkerIndex, TaskArena*& Arena) noexcept
+    {
+        // Order: Own Pinned Tasks -> Shared/Arena Tasks -> Pinned Tasks Of Workers That Are Busy
+        Arena = nullptr;
+
+        if (IsTaskReady(m_WorkerQueues[WorkerIndex]))
+        {
+            return &m_WorkerQueues[WorkerIndex];
+        }
+
+        // Arenas Below Their Reservation Always Qualify - Anything Else Must Leave Their Reserved Workers Idle
+        const bool            Unreserved     = GetIdleWorkerCount() > GetReservedIdleWorkers();
+
+        // Weighted Fair Share - Pick The Queue With The Lowest Active Tasks / Weight
+        // The Shared Queue Counts As Weight 1 With No Concurrency Limit
+        TaskQueue*            Selected       = Unreserved && IsTaskReady(m_TaskQueue) ? &m_TaskQueue : nullptr;
+        size_t                SelectedActive = m_SharedActiveTasks;
+        size_t                SelectedWeight = 1;
+
+        for (auto& Candidate : m_Arenas)
+        {
+            if (!IsTaskReady(Candidate.m_TaskQueue) || !Candidate.HasCapacity())
+            {
+                continue;
+            }
+
+            if (!Unreserved && Candidate.m_ActiveTasks >= Candidate.m_ReservedConcurrency)
+            {
+                continue;
+            }
+
+            if (!Selected || Candidate.m_ActiveTasks * SelectedWeight < SelectedActive * Candidate.m_Weight)
+            {
+                Selected       = &Candidate.m_TaskQueue;
+                SelectedActive = Candidate.m_ActiveTasks;
+                SelectedWeight = Candidate.m_Weight;
+                Arena          = &Candidate;
             }
         }
+
+        if (Selected)
+        {
+            return Selected;
+        }
+
+        // Idle Owners Pick Up Their Own Tasks Once Notified - Only Steal To Avoid Waiting On A Busy Owner
+        for (size_t i = 1; Unreserved && i < m_AvailableThreads; ++i)
+        {
+            const size_t Owner = (WorkerIndex + i) % m_AvailableThreads;
+            if (m_WorkerBusy[Owner] && IsTaskReady(m_WorkerQueues[Owner]))
+            {
+                return &m_WorkerQueues[Owner];
+            }
+        }
+
+        return nullptr;
+    }
+
+    [[nodiscard]] inline
+    size_t ThreadPool::GetReservedIdleWorkers(void) const noexcept
+    {
+        size_t Reserved = 0;
+        for (const auto& Arena : m_Arenas)
+        {
+            Reserved += Arena.m_ReservedConcurrency - std::min(Arena.m_ActiveTasks, Arena.m_ReservedConcurrency);
+        }
+        return std::min(Reserved, m_AvailableThreads - 1);
+    }
+
+    [[nodiscard]] inline
+    size_t ThreadPool::GetIdleWorkerCount(void) const noexcept
+    {
+        return static_cast<size_t>(std::count(m_WorkerBusy.get(), m_WorkerBusy.get() + m_AvailableThreads, false));
+    }
+
+    [[nodiscard]] inline
+    TaskArena* ThreadPool::FindArenaUnlocked(std::string_view Name) noexcept
+    {
+        for (auto& Arena : m_Arenas)
+        {
+            if (Arena.GetName() == Name)
+            {
+                return &Arena;
+            }
+        }
+        return nullptr;
+    }
+
+    [[nodiscard]] inline
+    bool ThreadPool::IsTaskReady(const TaskQueue& Queue) const noexcept
+    {
+#if defined(JPD_SCHEDULER_STRESS)
+        // While Replaying, Only The Next Task In The Recorded Order May Start
+        return !Queue.empty() && m_Stress.CanStart(Queue.front().m_TaskID);
+#else
+        return !Queue.empty();
+#endif
+    }
+
+    [[nodiscard]] inline
+    ThreadPool::VoidFunc ThreadPool::PopTask(TaskQueue& Queue) noexcept
+    {
+        VoidFunc Task = std::move(Queue.front().m_Func);
+
+#if defined(JPD_SCHEDULER_STRESS)
+        const bool Replaying = m_Stress.IsReplaying();
+        m_Stress.OnTaskStarted(Queue.front().m_TaskID);
+
+        // The Next Recorded Task May Already Be Queued - Wake Whoever Can Run It
+        if (Replaying)
+        {
+            m_CVNewTask.notify_all();
+            for (auto& Arena : m_Arenas)
+            {
+                Arena.m_CVTaskCompleted.notify_all();
+            }
+        }
+#endif
+
+        Queue.pop();
+        return Task;
+    }
+
+    inline
+    void ThreadPool::CompleteTask(TaskArena* Arena) noexcept
+    {
+        --m_TotalTaskCount;
+
+        if (Arena)
+        {
+            --Arena->m_ActiveTasks;
+            Arena->m_CVTaskCompleted.notify_all();
+
+            // A Slot Under The Arena's Concurrency Limit Just Opened Up
+            if (!Arena->m_TaskQueue.empty())
+            {
+                m_CVNewTask.notify_one();
+            }
+        }
+
+        // Every Waiter Re-Checks Its Own Condition
+        if (m_Waiting)
+        {
+            m_CVTaskCompleted.notify_all();
+        }
+    }
+
+    [[nodiscard]] inline
+    size_t ThreadPool::GetQueuedTaskCount(void) const noexcept
+    {
+        size_t QueuedTasks = m_TaskQueue.size();
+        for (const auto& Arena : m_Arenas)
+        {
+            QueuedTasks += Arena.m_TaskQueue.size();
+        }
+        for (size_t i = 0; i < m_AvailableThreads; ++i)
+        {
+            QueuedTasks += m_WorkerQueues[i].size();
+        }
+        return QueuedTasks;
     }
 
 
@@ -208,23 +757,19 @@ namespace jpd
     */
     template <typename Container>
     requires( std::ranges::contiguous_range<Container> )
-    inline [[nodiscard]]
+    [[nodiscard]] inline
     std::vector<size_t> ThreadPool::PartitionData(const Container& Data, const size_t PartitionCount) noexcept
     {
         return PartitionData(Data.size(), PartitionCount);
     }
 
-    inline [[nodiscard]]
+    [[nodiscard]] inline
     std::vector<size_t> ThreadPool::PartitionData(const size_t DataCount, const size_t PartitionCount) noexcept
     {
         // There Should Be Elements To Partition
         assert(DataCount > 0);
 
-        size_t Block = (DataCount / PartitionCount);
-        float  FBlock = (DataCount / static_cast<float>(PartitionCount));
-
-        size_t MainBlock = Block != FBlock ? Block + 1
-            : Block;
+        size_t MainBlock = DivideRoundUp(DataCount, PartitionCount);
         size_t LastBlock = DataCount - (MainBlock * (PartitionCount - 1));
 
         std::vector<size_t> PartitionedGroupSize(PartitionCount, MainBlock);
@@ -234,7 +779,7 @@ namespace jpd
         return PartitionedGroupSize;
     }
 
-    inline [[nodiscard]]
+    [[nodiscard]] inline
     std::vector<size_t> ThreadPool::PartitionLoopIndices(size_t StartIndex, size_t EndIndex, const size_t PartitionCount, const size_t MinimumPartitionSize) noexcept
     {
         if (EndIndex < StartIndex)
@@ -242,24 +787,19 @@ namespace jpd
             std::swap(StartIndex, EndIndex);
         }
 
-        size_t DataCount = EndIndex - StartIndex;
-        size_t Block = MinimumPartitionSize ? MinimumPartitionSize
-                                            : ( DataCount / PartitionCount );
-        float  FBlock = MinimumPartitionSize ? static_cast<float>(MinimumPartitionSize)
-                                             : (DataCount / static_cast<float>(PartitionCount));
-
-        size_t MainBlockSize = (Block != FBlock) && (Block < DataCount) ? Block + 1 // might need update this
-                                                                        : Block;
-
-        std::vector<size_t> PartitionedGroupSize(std::ceil(DataCount / static_cast<float>(MainBlockSize)) + 1);
+        // Returns A Vector Of Starting Indices Of The For Loop
+        return PartitionRange(StartIndex, EndIndex, PartitionCount, MinimumPartitionSize);
+    }
 
-        for (size_t i = 0, max = PartitionedGroupSize.size(); i < max - 1; ++i)
+    [[nodiscard]] inline
+    std::vector<size_t> ThreadPool::PartitionAlignedLoopIndices(size_t StartIndex, size_t EndIndex, const size_t PartitionCount, const size_t MinimumPartitionSize, const PartitionAlignment Alignment) noexcept
+    {
+        if (EndIndex < StartIndex)
         {
-            PartitionedGroupSize[i] = StartIndex + i * MainBlockSize;
+            std::swap(StartIndex, EndIndex);
         }
-        PartitionedGroupSize[PartitionedGroupSize.size() - 1] = EndIndex;
 
-        // Returns A Vector Of Starting Indices Of The For Loop
-        return PartitionedGroupSize;
+        // Inner Boundaries Land On Multiples Of The Alignment So Neighbouring Workers Never Write The Same Cache Line/Page
+        return PartitionRange(StartIndex, EndIndex, PartitionCount, MinimumPartitionSize, Alignment.GetGranularity(), Alignment.m_AlignedIndex);
     }
 }
\ No newline at end of file
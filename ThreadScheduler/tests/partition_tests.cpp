@@ -0,0 +1,74 @@
+#include "includes/thread_pool_includes.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+/*
+    Partition Helper Checks - Tile Counts & Chunk Boundary Alignment
+*/
+static int g_Failures = 0;
+
+#define PARTITION_CHECK(Condition)                                                      \
+    do                                                                                  \
+    {                                                                                   \
+        if (!(Condition))                                                               \
+        {                                                                               \
+            std::printf("\tPARTITION_CHECK(%s) Failed At Line %d\n", #Condition, __LINE__); \
+            ++g_Failures;                                                               \
+        }                                                                               \
+    } while (0)
+
+
+// The Product Of The Tile Counts Never Exceeds The Requested Partition Count
+void TileCountsNeverOvershoot()
+{
+    const auto Square = jpd::ComputeTileCounts<2>( { 1000, 1000 }, { 1, 1 }, 7 );
+    PARTITION_CHECK(Square[0] * Square[1] == 6);
+
+    const auto Image = jpd::ComputeTileCounts<2>( { 48, 100 }, { 1, 16 }, 16 );
+    PARTITION_CHECK(Image[0] * Image[1] <= 16);
+
+    for (size_t PartitionCount = 1; PartitionCount <= 64; ++PartitionCount)
+    {
+        const auto Volume = jpd::ComputeTileCounts<3>( { 64, 48, 100 }, { 1, 1, 16 }, PartitionCount );
+        PARTITION_CHECK(Volume[0] * Volume[1] * Volume[2] <= PartitionCount);
+    }
+}
+
+
+// Inner Boundaries Land On Aligned Addresses Wherever The Data Itself Starts
+void BoundariesFollowBaseAddress()
+{
+    constexpr size_t Count = 1024;
+    auto* Storage = static_cast<int64_t*>(::operator new[]((Count + 8) * sizeof(int64_t), std::align_val_t{ jpd::CacheLineSize }));
+
+    for (size_t Offset = 0; Offset < 8; ++Offset)
+    {
+        const int64_t* Base       = Storage + Offset;
+        const auto     Alignment  = jpd::AlignTo(Base);
+        const auto     Boundaries = jpd::PartitionRange( 3, Count, 8, 0, Alignment.GetGranularity(), Alignment.m_AlignedIndex );
+
+        PARTITION_CHECK(Boundaries.front() == 3 && Boundaries.back() == Count);
+        for (size_t i = 1; i < Boundaries.size() - 1; ++i)
+        {
+            PARTITION_CHECK(reinterpret_cast<uintptr_t>(Base + Boundaries[i]) % jpd::CacheLineSize == 0);
+        }
+    }
+
+    // No Element Of A Misaligned Array Can Ever Start A Line - Falls Back To Index 0
+    const auto* Misaligned = reinterpret_cast<const int64_t*>(reinterpret_cast<const char*>(Storage) + 1);
+    PARTITION_CHECK(jpd::AlignTo(Misaligned).m_AlignedIndex == 0);
+
+    ::operator delete[](Storage, std::align_val_t{ jpd::CacheLineSize });
+}
+
+
+int main()
+{
+    TileCountsNeverOvershoot();
+    BoundariesFollowBaseAddress();
+
+    std::printf("Partition Tests: %d Failures\n", g_Failures);
+    return g_Failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
\ No newline at end of file
@@ -0,0 +1,108 @@
+#include "includes/task_profiler_includes.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <sstream>
+
+/*
+    Task Profiler Checks - Self Time & Folded Stacks Of Nested Tasks
+*/
+static int g_Failures = 0;
+
+#define PROFILER_CHECK(Condition)                                                       \
+    do                                                                                  \
+    {                                                                                   \
+        if (!(Condition))                                                               \
+        {                                                                               \
+            std::printf("\tPROFILER_CHECK(%s) Failed At Line %d\n", #Condition, __LINE__); \
+            ++g_Failures;                                                               \
+        }                                                                               \
+    } while (0)
+
+constexpr size_t Inner_Count = 4;
+
+
+// Busy For Duration Of Wall Time - Also Burns CPU Time Where It Is Measured
+void Spin(const std::chrono::milliseconds Duration)
+{
+    const auto End = std::chrono::steady_clock::now() + Duration;
+    while (std::chrono::steady_clock::now() < End)
+    {
+    }
+}
+
+
+// A Single Worker Waiting On An Arena Runs Its Tasks Inside The Outer Task - Outer Keeps Only Its Own Time
+void NestedTasksRecordSelfTime()
+{
+    jpd::ThreadPool Pool( 1 );
+    auto& Inner = Pool.CreateArena( "Inner" );
+    Pool.GetProfiler().Enable();
+
+    auto Outer = Pool.QueueFunction( "Outer", [&Inner]()
+                                              {
+                                                  for (size_t i = 0; i < Inner_Count; ++i)
+                                                  {
+                                                      (void)Inner.QueueFunction( []{ Spin(std::chrono::milliseconds(20)); } );
+                                                  }
+                                                  Inner.WaitForAllTasks();
+                                              } );
+    Outer.get();
+    Pool.WaitForAllTasks();
+
+    const jpd::TaskProfileEntry* OuterEntry = nullptr;
+    const jpd::TaskProfileEntry* InnerEntry = nullptr;
+    const auto Entries = jpd::SnapshotProfile(Pool.GetProfiler());
+    for (const auto& Entry : Entries)
+    {
+        const auto Name = jpd::GetLabelName(Entry.m_Label);
+        OuterEntry = Name == "Outer" ? &Entry : OuterEntry;
+        InnerEntry = Name == "Inner" ? &Entry : InnerEntry;
+    }
+
+    PROFILER_CHECK(Entries.size() == 2);
+    PROFILER_CHECK(OuterEntry && OuterEntry->m_Count == 1);
+    PROFILER_CHECK(InnerEntry && InnerEntry->m_Count == Inner_Count);
+    if (OuterEntry && InnerEntry)
+    {
+        PROFILER_CHECK(InnerEntry->m_WallNs >= Inner_Count * 20'000'000ull);
+        PROFILER_CHECK(OuterEntry->m_WallNs < InnerEntry->m_WallNs / Inner_Count);
+        PROFILER_CHECK(OuterEntry->m_CpuNs <= InnerEntry->m_CpuNs / Inner_Count);
+    }
+
+    // Nested Frames Appear Under Their Parent Only - flamegraph.pl Must Not Count Them Twice
+    std::ostringstream Folded;
+    jpd::PrintFoldedStacks(Pool.GetProfiler(), Folded);
+    const std::string Stacks = Folded.str();
+
+    PROFILER_CHECK(Stacks.find("Worker 0;Outer ") != std::string::npos);
+    PROFILER_CHECK(Stacks.find("Worker 0;Outer;Inner ") != std::string::npos);
+    PROFILER_CHECK(Stacks.find("Worker 0;Inner ") == std::string::npos);
+}
+
+
+// Top-Level Tasks Keep Their Flat Single-Frame Stacks
+void TopLevelTasksStayFlat()
+{
+    jpd::ThreadPool Pool( 1 );
+    Pool.GetProfiler().Enable();
+
+    (void)Pool.QueueFunction( "Flat", []{ Spin(std::chrono::milliseconds(1)); } );
+    Pool.WaitForAllTasks();
+
+    std::ostringstream Folded;
+    jpd::PrintFoldedStacks(Pool.GetProfiler(), Folded);
+    PROFILER_CHECK(Folded.str().rfind("Worker 0;Flat ", 0) == 0);
+}
+
+
+int main()
+{
+    NestedTasksRecordSelfTime();
+    TopLevelTasksStayFlat();
+
+    std::printf("Profiler Tests: %d Failures\n", g_Failures);
+    return g_Failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
\ No newline at end of file
@@ -0,0 +1,286 @@
+#include "includes/thread_pool_includes.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <future>
+#include <thread>
+#include <vector>
+
+/*
+    Scheduling Stress Suite - Runs Each Case Once Per Seed With Yield Injection Enabled
+    Usage: ThreadScheduler_StressTests [SeedCount = 16] [FirstSeed = 1]
+
+    **Note: A Failure Prints Its Seed - Rerun With That Seed As FirstSeed & SeedCount 1 To Reproduce
+*/
+#if !defined(JPD_SCHEDULER_STRESS)
+    #error "Build The Stress Suite With JPD_SCHEDULER_STRESS Defined"
+#endif
+
+static std::atomic_uint64_t g_Seed     = 0;
+static std::atomic_int32_t  g_Failures = 0;
+
+#define STRESS_CHECK(Condition)                                                         \
+    do                                                                                  \
+    {                                                                                   \
+        if (!(Condition))                                                               \
+        {                                                                               \
+            std::printf( "\tSeed %llu: STRESS_CHECK(%s) Failed At Line %d\n"            \
+                       , static_cast<unsigned long long>(g_Seed.load()), #Condition, __LINE__ ); \
+            ++g_Failures;                                                               \
+        }                                                                               \
+    } while (0)
+
+constexpr size_t Producer_Count     = 4;
+constexpr size_t Tasks_Per_Producer = 128;
+constexpr size_t Task_Count         = Producer_Count * Tasks_Per_Producer;
+
+
+// Producers Queue Shared & Pinned Tasks, Then All Call WaitForAllTasks At Once While Another Thread Polls The Counts
+void ConcurrentPoolWaits(const uint64_t Seed)
+{
+    jpd::ThreadPool Pool( Producer_Count );
+    Pool.SeedStress(Seed);
+
+    std::array<std::atomic_size_t, Producer_Count> Completed{};
+    std::atomic_bool Done = false;
+
+    std::thread Observer( [&Pool, &Done]()
+                          {
+                              while (!Done)
+                              {
+                                  const size_t Total  = Pool.GetTotalTaskCount();
+                                  const size_t Active = Pool.GetActiveTaskCount();
+                                  STRESS_CHECK(Total <= Task_Count);
+                                  STRESS_CHECK(Active <= Task_Count);
+                              }
+                          } );
+
+    std::vector<std::thread> Producers;
+    for (size_t p = 0; p < Producer_Count; ++p)
+    {
+        Producers.emplace_back( [&Pool, &Completed, p]()
+                                {
+                                    for (size_t i = 0; i < Tasks_Per_Producer; ++i)
+                                    {
+                                        auto Increment = [&Completed, p]{ ++Completed[p]; };
+                                        if (i % 2)
+                                        {
+                                            (void)Pool.QueueFunctionOnWorker( i, Increment );
+                                        }
+                                        else
+                                        {
+                                            (void)Pool.QueueFunction( Increment );
+                                        }
+                                    }
+
+                                    // Every Task This Thread Queued Was Counted Before The Wait Began
+                                    Pool.WaitForAllTasks();
+                                    STRESS_CHECK(Completed[p] == Tasks_Per_Producer);
+                                } );
+    }
+
+    for (auto& Producer : Producers)
+    {
+        Producer.join();
+    }
+    Done = true;
+    Observer.join();
+
+    Pool.WaitForAllTasks();
+    STRESS_CHECK(Pool.GetTotalTaskCount() == 0);
+    STRESS_CHECK(Pool.GetActiveTaskCount() == 0);
+}
+
+
+// External Threads & Worker Tasks Wait On Arenas - Workers Help Run The Arena's Tasks While Waiting
+void ConcurrentArenaWaits(const uint64_t Seed)
+{
+    jpd::ThreadPool Pool( Producer_Count );
+    Pool.SeedStress(Seed);
+
+    auto& Narrow = Pool.CreateArena( "Narrow", 1 );
+    auto& Wide   = Pool.CreateArena( "Wide", 0, 2 );
+
+    std::atomic_size_t Completed     = 0;
+    std::atomic_size_t Nested        = 0;
+    std::atomic_size_t NarrowRunning = 0;
+    std::atomic_bool   Done          = false;
+
+    std::thread Observer( [&Narrow, &Wide, &Done]()
+                          {
+                              while (!Done)
+                              {
+                                  STRESS_CHECK(Narrow.GetTotalTaskCount() <= Task_Count + Producer_Count);
+                                  STRESS_CHECK(Wide.GetTotalTaskCount() <= Task_Count + Producer_Count);
+                              }
+                          } );
+
+    std::vector<std::thread> Producers;
+    for (size_t p = 0; p < Producer_Count; ++p)
+    {
+        Producers.emplace_back( [&, p]()
+                                {
+                                    auto& Arena = p % 2 ? Narrow : Wide;
+                                    std::vector<std::future<void>> Futures;
+                                    for (size_t i = 0; i < Tasks_Per_Producer; ++i)
+                                    {
+                                        Futures.push_back(Arena.QueueFunction( [&Completed, &NarrowRunning, IsNarrow = (&Arena == &Narrow)]()
+                                                                               {
+                                                                                   // Helping Workers Must Respect Narrow's Limit Of 1
+                                                                                   if (IsNarrow)
+                                                                                   {
+                                                                                       STRESS_CHECK(++NarrowRunning == 1);
+                                                                                       std::this_thread::yield();
+                                                                                       --NarrowRunning;
+                                                                                   }
+                                                                                   ++Completed;
+                                                                               } ));
+                                    }
+
+                                    // Worker Waiting On An Arena From Inside A Task - Helps Run It
+                                    auto& Other = p % 2 ? Wide : Narrow;
+                                    Futures.push_back(Pool.QueueFunction( [&Other, &Nested]()
+                                                                          {
+                                                                              (void)Other.QueueFunction( [&Nested]{ ++Nested; } );
+                                                                              Other.WaitForAllTasks();
+                                                                          } ));
+
+                                    Arena.WaitForAllTasks();
+                                    for (size_t i = 0; i < Tasks_Per_Producer; ++i)
+                                    {
+                                        STRESS_CHECK(Futures[i].wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+                                    }
+                                    Futures.back().wait();
+                                } );
+    }
+
+    for (auto& Producer : Producers)
+    {
+        Producer.join();
+    }
+    Done = true;
+    Observer.join();
+
+    Pool.WaitForAllTasks();
+    STRESS_CHECK(Completed == Task_Count);
+    STRESS_CHECK(Nested == Producer_Count);
+    STRESS_CHECK(Narrow.GetTotalTaskCount() == 0);
+    STRESS_CHECK(Wide.GetTotalTaskCount() == 0);
+    STRESS_CHECK(Pool.GetTotalTaskCount() == 0);
+}
+
+
+// Shared Tasks Hold Every Unreserved Worker - The Reserved Arena's Task Must Still Start Right Away
+void ReservedArenaUnderLoad(const uint64_t Seed)
+{
+    // A Single Worker Cannot Be Reserved - It Always Serves The Shared Queue
+    if (std::thread::hardware_concurrency() < 2)
+    {
+        return;
+    }
+
+    jpd::ThreadPool Pool( Producer_Count );
+    Pool.SeedStress(Seed);
+
+    // Concurrent Creation Of One Name Yields One Arena
+    std::array<jpd::TaskArena*, Producer_Count> Created{};
+    std::vector<std::thread> Creators;
+    for (size_t p = 0; p < Producer_Count; ++p)
+    {
+        Creators.emplace_back( [&Pool, &Created, p]{ Created[p] = &Pool.CreateArena( "Reserved", 1, 1, 1 ); } );
+    }
+    for (auto& Creator : Creators)
+    {
+        Creator.join();
+    }
+    auto& Reserved = *Created[0];
+    for (auto* Arena : Created)
+    {
+        STRESS_CHECK(Arena == &Reserved);
+    }
+    STRESS_CHECK(Pool.FindArena( "Reserved" ) == &Reserved);
+    STRESS_CHECK(Reserved.GetReservedConcurrency() == 1);
+
+    std::atomic_bool Release = false;
+    const auto Deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    for (size_t i = 0; i < Task_Count; ++i)
+    {
+        (void)Pool.QueueFunction( [&Release, Deadline]
+                                  {
+                                      while (!Release && std::chrono::steady_clock::now() < Deadline)
+                                      {
+                                          std::this_thread::yield();
+                                      }
+                                  } );
+    }
+
+    auto Reserved_Task = Reserved.QueueFunction( []{ return true; } );
+    STRESS_CHECK(Reserved_Task.wait_for(std::chrono::seconds(5)) == std::future_status::ready);
+
+    Release = true;
+    Pool.WaitForAllTasks();
+    STRESS_CHECK(Pool.GetTotalTaskCount() == 0);
+}
+
+
+// Replay Must Reproduce The Recorded Start Order Across Shared, Pinned & Arena Queues
+void ReplayAcrossQueues(const uint64_t Seed)
+{
+    jpd::ThreadPool Pool( Producer_Count );
+    Pool.SeedStress(Seed);
+
+    auto& Narrow = Pool.CreateArena( "Narrow", 1 );
+    auto& Wide   = Pool.CreateArena( "Wide", 0, 2 );
+
+    auto RunTasks = [&]()
+                    {
+                        std::vector<std::future<void>> Futures;
+                        for (size_t i = 0; i < Tasks_Per_Producer; ++i)
+                        {
+                            switch (i % 4)
+                            {
+                            case 0:  Futures.push_back(Pool.QueueFunction( []{ std::this_thread::yield(); } ));                  break;
+                            case 1:  Futures.push_back(Pool.QueueFunctionOnWorker( i / 4, []{ std::this_thread::yield(); } ));   break;
+                            case 2:  Futures.push_back(Narrow.QueueFunction( []{ std::this_thread::yield(); } ));                break;
+                            default: Futures.push_back(Wide.QueueFunction( []{ std::this_thread::yield(); } ));                  break;
+                            }
+                        }
+                        for (auto& Future : Futures)
+                        {
+                            Future.wait();
+                        }
+                    };
+
+    Pool.BeginRecording();
+    RunTasks();
+    const auto Recorded = Pool.EndRecording();
+
+    Pool.BeginReplay(Recorded);
+    RunTasks();
+    const auto Replayed = Pool.EndReplay();
+
+    STRESS_CHECK(Recorded.size() == Tasks_Per_Producer);
+    STRESS_CHECK(Recorded == Replayed);
+}
+
+
+int main(int argc, char* argv[])
+{
+    const uint64_t SeedCount = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 16;
+    const uint64_t FirstSeed = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1;
+
+    for (uint64_t Seed = FirstSeed; Seed < FirstSeed + SeedCount; ++Seed)
+    {
+        g_Seed = Seed;
+        ConcurrentPoolWaits(Seed);
+        ConcurrentArenaWaits(Seed);
+        ReplayAcrossQueues(Seed);
+        ReservedArenaUnderLoad(Seed);
+    }
+
+    std::printf("Stress Suite: %llu Seeds | %d Failures\n", static_cast<unsigned long long>(SeedCount), g_Failures.load());
+    return g_Failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
\ No newline at end of file